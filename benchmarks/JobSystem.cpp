@@ -0,0 +1,33 @@
+#include "Core/JobSystem.h"
+#include <chrono>
+#include <cstdio>
+
+// Per-job scheduling overhead, with 0, 1 and 3 workers beside the calling thread.
+// The jobs are empty, so what is measured is scheduling, execution bookkeeping
+// and waiting.
+
+int main() {
+    for (size_t threads : { 0, 1, 3 }) {
+        JobSystem jobs(threads);
+
+        const size_t count = 200000;
+        auto t0 = std::chrono::steady_clock::now();
+
+        JobCounter counter;
+        for (size_t i = 0; i < count; ++i)
+            jobs.Schedule([] {}, &counter);
+        jobs.Wait(counter);
+
+        auto t1 = std::chrono::steady_clock::now();
+
+        const size_t rounds = 2000;
+        for (size_t round = 0; round < rounds; ++round)
+            jobs.ParallelFor(64, 1, [](size_t, size_t) {});
+        auto t2 = std::chrono::steady_clock::now();
+
+        std::printf("[JobSystem] %zu workers: %.1f ns per empty job, %.2f us per 64-chunk ParallelFor\n", threads,
+                    std::chrono::duration<double, std::nano>(t1 - t0).count() / count,
+                    std::chrono::duration<double, std::micro>(t2 - t1).count() / rounds);
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "Core/World/World.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// The physics scene behind the ms/tick figures quoted for the narrowphase work:
+// a field of anchored walls and free bodies, a third of them circles and the rest
+// rectangles or hexagons, ticked at 64 Hz from a fixed seed.
+//
+//   scene [bodies=300] [ticks=32] [tree] [islands] [polygons] [threads=N] [nosleep] [nowarm]
+//
+// Prints the mean tick time to stderr and a position checksum to stdout, so runs
+// with different settings or builds can be checked for identical results.
+
+int main(int argc, char** argv) {
+    int bodies = argc > 1 ? std::atoi(argv[1]) : 300;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 32;
+
+    PhysicsSettings settings;
+    bool polygons = false;
+    for (int i = 3; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (!std::strcmp(arg, "tree")) settings.broadphase = BroadphaseType::AABBTree;
+        else if (!std::strcmp(arg, "islands")) settings.solver = SolverMode::Islands;
+        else if (!std::strcmp(arg, "polygons")) polygons = true;
+        else if (!std::strncmp(arg, "threads=", 8)) settings.narrowphaseThreads = unsigned(std::atoi(arg + 8));
+        else if (!std::strcmp(arg, "nosleep")) settings.sleepTicks = 0;
+        else if (!std::strcmp(arg, "nowarm")) settings.warmStarting = false;
+        else {
+            std::fprintf(stderr, "[Scene] unknown option %s\n", arg);
+            return 1;
+        }
+    }
+
+    World world(true);
+    world.SetPhysicsSettings(settings);
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> pos(0, 2000), vel(-100, 100);
+    for (int i = 0; i < 20; ++i) {
+        auto& wall = world.SpawnObject<GameObject>();
+        wall.SetPosition({ pos(rng), pos(rng) });
+        wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 200.0, 20.0 }));
+        wall.GetPhysicalProperties()->SetAnchored(true);
+    }
+    for (int i = 0; i < bodies; ++i) {
+        auto& body = world.SpawnObject<GameObject>();
+        body.SetPosition({ pos(rng), pos(rng) });
+        body.SetVelocity({ vel(rng), vel(rng) });
+        if (i % 3 == 0)
+            body.GetHitbox()->AddHitbox(CircleShape(Vector2d(5, 5), 5.0f));
+        else if (polygons)
+            body.GetHitbox()->AddHitbox(PolygonShape({ { 3, 0 }, { 7, 0 }, { 10, 5 }, { 7, 10 }, { 3, 10 }, { 0, 5 } }));
+        else
+            body.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; ++i) world.Tick(1.0f / 64.0f);
+    auto end = std::chrono::steady_clock::now();
+
+    double checksum = 0;
+    for (auto& obj : world.GetObjects()) checksum += obj->GetPosition().x * 1.37 + obj->GetPosition().y;
+    std::fprintf(stderr, "[Scene] %.3f ms/tick\n", std::chrono::duration<double, std::milli>(end - start).count() / ticks);
+    std::printf("%.9f\n", checksum);
+    return 0;
+}
@@ -30,44 +30,10 @@ public:
     }
 
     bool OutsideCamera(const GameObject& object) const {
-        auto* transform = object.GetComponent<TransformComponent>();
-        if (!transform) return true;
-        Vector2d objPos = transform->GetPosition();
-
         auto hitbox = object.GetHitbox();
-        if (!hitbox) return true;
-
-        auto& hitboxes = hitbox->GetHitboxes();
-        for (auto& h: hitboxes) {
-            if (auto rectShape = dynamic_cast<RectShape*>(h.shape.get())) {
-                auto bounds = rectShape->GetBounds().Translated(objPos);
-                if (bounds.x + bounds.width < position.x) continue; // left
-                if (bounds.x > position.x + width) continue; // right
-                if (bounds.y + bounds.height < position.y) continue; // above
-                if (bounds.y > position.y + height) continue; // below
-                return false; // inside camera
-            }
-            else if (auto circleShape = dynamic_cast<CircleShape*>(h.shape.get())) {
-                auto center = circleShape->GetCenter() + objPos;
-                float radius = circleShape->GetRadius();
-                if (center.x + radius < position.x) continue; // left
-                if (center.x - radius > position.x + width) continue; // right
-                if (center.y + radius < position.y) continue; // above
-                if (center.y - radius > position.y + height) continue; // below
-                return false; // inside camera
-            }
-            else if (auto polygonShape = dynamic_cast<PolygonShape*>(h.shape.get())) {
-                for (const auto& vertex : polygonShape->GetVertices()) {
-                    Vector2d worldVertex = vertex + objPos;
-                    if (worldVertex.x >= position.x && worldVertex.x <= position.x + width &&
-                        worldVertex.y >= position.y && worldVertex.y <= position.y + height) {
-                        return false; // inside camera
-                    }
-                }
-            }
-        }
+        if (!hitbox || hitbox->GetHitboxes().empty()) return false; // nothing to cull by
 
-        return false;
+        return !object.GetWorldBounds().Intersects(Rect2d(position.x, position.y, width, height));
     }
 
     bool InsideCamera(const GameObject& object) const {
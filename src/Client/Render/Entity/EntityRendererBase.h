@@ -8,19 +8,19 @@
 class EntityRendererBase {
 public:
     virtual ~EntityRendererBase() = default;
-    virtual void Render(const GameObject& object, IRenderer& backend, const Camera& camera) = 0;
+    virtual void Render(const GameObject& object, const Vector2d& position, IRenderer& backend, const Camera& camera) = 0;
 };
 
 // Template for typed entity renderers
 template <typename T>
 class EntityRenderer : public EntityRendererBase {
 public:
-    virtual void RenderEntity(const T& entity, IRenderer& backend, const Camera& camera) = 0;
+    virtual void RenderEntity(const T& entity, const Vector2d& position, IRenderer& backend, const Camera& camera) = 0;
     virtual RenderInfo GetRenderInfo() const = 0;
 
-    void Render(const GameObject& object, IRenderer& backend, const Camera& camera) override {
+    void Render(const GameObject& object, const Vector2d& position, IRenderer& backend, const Camera& camera) override {
         const T& derived = static_cast<const T&>(object);
         if (camera.OutsideCamera(object)) return;
-        RenderEntity(derived, backend, camera);
+        RenderEntity(derived, position, backend, camera);
     }
 };
\ No newline at end of file
@@ -17,12 +17,8 @@ public:
         };
     }
 
-    void RenderEntity(const PlayerEntity& player, IRenderer& backend, const Camera& camera) override {
-        auto* transform = player.GetComponent<TransformComponent>();
-        if (!transform) return;
-        auto pos = transform->GetPosition();
-
-        backend.DrawGameObject(player);
+    void RenderEntity(const PlayerEntity& player, const Vector2d& position, IRenderer& backend, const Camera& camera) override {
+        backend.DrawGameObject(player, position);
         // std::cout << "[PlayerRenderer] Drawing Player at ("
                   // << pos.x << ", " << pos.y << ")\n";
     }
@@ -6,7 +6,7 @@ class DummyRenderer : public IRenderer {
 public:
     void Initialize() override;
     void ClearFrame() override;
-    void DrawGameObject(const GameObject& obj) override;
+    void DrawGameObject(const GameObject& obj, const Vector2d& position) override;
     void PresentFrame() override;
     void SetTitle(const std::string& title) override;
 };
\ No newline at end of file
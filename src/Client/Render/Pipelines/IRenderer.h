@@ -13,7 +13,8 @@ public:
     virtual void Initialize() = 0;
     virtual void ClearFrame() = 0;
 
-    virtual void DrawGameObject(const GameObject& obj) = 0;
+    // position: where to draw obj, which may lag its simulated position (see WorldRenderer)
+    virtual void DrawGameObject(const GameObject& obj, const Vector2d& position) = 0;
     virtual void DrawLine(Vector2f from, Vector2f to, SDL_Color color) = 0;
     virtual void DrawCircle(Vector2f center, float radius, SDL_Color color) = 0;
     virtual void DrawCircleFilled(Vector2f center, float radius, SDL_Color color) = 0;
@@ -48,20 +48,16 @@ public:
         SDL_RenderClear(renderer);
     }
 
-    void DrawGameObject(const GameObject& obj) override {
-        auto* transform = obj.GetComponent<TransformComponent>();
-        if (!transform) return;
-
-        Vector2d pos = transform->GetPosition();
+    void DrawGameObject(const GameObject& obj, const Vector2d& position) override {
         const auto& hitbox = *obj.GetHitbox();
 
         for (auto& h: hitbox.GetHitboxes()) {
-            DrawShape(h.shape, pos);
+            DrawShape(h.shape, position);
         }
     }
 
-    void DrawShape(const std::unique_ptr<HitboxShape>& shape, Vector2d worldPos) {
-        if (auto rectShape = dynamic_cast<RectShape*>(shape.get())) {
+    void DrawShape(const HitboxShape& shape, Vector2d worldPos) {
+        if (auto rectShape = shape.GetIf<RectShape>()) {
             auto serverBounds = rectShape->GetBounds().Translated(worldPos);
             SDL_FRect rect;
             rect.x = serverBounds.x;
@@ -72,7 +68,7 @@ public:
             SDL_SetRenderDrawColor(renderer, 155, 155, 155, 255);
             SDL_RenderFillRectF(renderer, &rect);
         }
-        else if (auto circleShape = dynamic_cast<CircleShape*>(shape.get())) {
+        else if (auto circleShape = shape.GetIf<CircleShape>()) {
             auto serverPos = circleShape->GetCenter() + worldPos;
             DrawCircle(serverPos, circleShape->GetRadius(), { 255, 0, 0, 255 });
         }
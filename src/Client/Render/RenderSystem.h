@@ -17,7 +17,8 @@ public:
     void Initialize();
     void SetTitle(const std::string& title);
 
-    void RenderWorld(const World& world);
+    // alpha: how far between the last two ticks to draw moving objects, see FixedTimestep
+    void RenderWorld(const World& world, double alpha = 1.0);
 
     IRenderer& GetBackend();
     WorldRenderer& GetWorldRenderer();
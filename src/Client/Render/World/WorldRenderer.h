@@ -16,7 +16,7 @@ public:
     explicit WorldRenderer(IRenderer& backend);
     ~WorldRenderer();
 
-    void Render(const World& world);
+    void Render(const World& world, double alpha = 1.0);
 
     template <typename T, typename RendererT>
     void RegisterRenderer();
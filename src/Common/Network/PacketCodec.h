@@ -52,6 +52,11 @@ public:
         buffer.insert(buffer.end(), data.begin(), data.end());
     }
 
+    // Appends bytes encoded by another codec as-is, without a length prefix
+    void WriteRaw(const std::vector<uint8_t>& data) {
+        buffer.insert(buffer.end(), data.begin(), data.end());
+    }
+
     void WriteUUID(const Util::UUID& uuid) {
         WriteBytes(std::vector<uint8_t>(uuid.bytes().begin(), uuid.bytes().end()));
     }
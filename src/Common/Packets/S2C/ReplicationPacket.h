@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Network/Packet.h"
+#include "Core/JobSystem.h"
 #include "Core/Objects/GameObject.h"
 class ReplicationPacket : public Packet {
 public:
@@ -16,13 +17,16 @@ public:
     struct ObjectState {
         Util::UUID uuid;
         ReplicationType type = ReplicationType::FullSync;
+        const Instance* source = nullptr;    // live object to encode when sending
         std::unique_ptr<Instance> instance; // decoded instance data
 
         void Encode(PacketCodec& codec) const {
             codec.WriteUUID(uuid);
             codec.Write<uint8_t>(static_cast<uint8_t>(type));
-            if (type != ReplicationType::Destroy && instance)
-                instance->Encode(codec);
+            if (type == ReplicationType::Destroy) return;
+            // Sent as a plain Instance, whatever the object's own type
+            if (source) source->Instance::Encode(codec);
+            else if (instance) instance->Encode(codec);
         }
 
         void Decode(PacketCodec& codec) {
@@ -38,26 +42,47 @@ public:
 
 private:
     std::vector<ObjectState> objects;
+    std::vector<PacketCodec> encoded; // per object, filled by EncodeObjects
+
 
 public:
     void AddObject(Instance* obj, ReplicationType type = ReplicationType::FullSync) {
         ObjectState state;
         state.uuid = obj->GetUUID();
         state.type = type;
-        state.instance = std::make_unique<Instance>(*obj); // copy for sending
+        state.source = obj; // encoded when the packet is, so it must outlive that
         objects.push_back(std::move(state));
+        encoded.clear();
+    }
+
+    // Encodes the object states up front as jobs, so Encode only concatenates
+    // them. The objects must not change between this and Encode.
+    void EncodeObjects(JobSystem& jobs) {
+        encoded.resize(objects.size());
+        jobs.ParallelFor(objects.size(), 16, [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                encoded[i].Reset();
+                objects[i].Encode(encoded[i]);
+            }
+        });
     }
 
     const std::vector<ObjectState>& GetObjects() const { return objects; }
 
     void Encode(PacketCodec& codec) const override {
         codec.Write<uint32_t>(objects.size());
+        if (!objects.empty() && encoded.size() == objects.size()) {
+            for (const auto& bytes : encoded)
+                codec.WriteRaw(bytes.Data());
+            return;
+        }
         for (const auto& obj : objects)
             obj.Encode(codec);
     }
 
     void Decode(PacketCodec& codec) override {
         uint32_t count = codec.Read<uint32_t>();
+        encoded.clear();
         objects.resize(count);
         for (uint32_t i = 0; i < count; ++i)
             objects[i].Decode(codec);
@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include "Core/Connection.h"
 #include "Common/Network/PacketCodec.h"
+#include "Core/SlabAllocator.h"
 
 class Instance;
 
@@ -12,6 +13,9 @@ protected:
     Instance* owner;
     bool enabled;
 
+    // Called after SetEnabled actually changes the state
+    virtual void OnEnabledChanged() {}
+
 public:
     Signal<> Enabled;
     Signal<> Disabled;
@@ -19,6 +23,10 @@ public:
     Component();
     virtual ~Component();
 
+    // Pooled along with the objects that own them
+    static void* operator new(size_t size) { return SlabAllocator::Allocate(size); }
+    static void operator delete(void* block, size_t size) { SlabAllocator::Free(block, size); }
+
     virtual void OnAttach(Instance* gameObject);
     virtual void OnDetach();
     virtual void Tick(float dt);
@@ -9,21 +9,28 @@
 class ComponentRegistry {
     using Factory = std::function<std::unique_ptr<Component>()>;
 
-    static std::unordered_map<std::string, Factory>& registry() {
-        static std::unordered_map<std::string, Factory> inst;
+    struct Entry {
+        Factory create;
+        ComponentTypeId id;
+        bool ticks;
+    };
+
+    static std::unordered_map<std::string, Entry>& registry() {
+        static std::unordered_map<std::string, Entry> inst;
         return inst;
     }
 
-    static std::unordered_map<std::type_index, std::string>& reverse() {
-        static std::unordered_map<std::type_index, std::string> inst;
+    static std::unordered_map<ComponentTypeId, std::string>& reverse() {
+        static std::unordered_map<ComponentTypeId, std::string> inst;
         return inst;
     }
 
 public:
     template<typename T>
     static void Register(const std::string& name) {
-        registry()[name] = []() { return std::make_unique<T>(); };
-        reverse()[std::type_index(typeid(T))] = name;
+        ComponentTypeId id = ComponentTypes::IdOf<T>();
+        registry()[name] = { []() { return std::make_unique<T>(); }, id, ComponentTypes::TicksOf<T>() };
+        reverse()[id] = name;
     }
 
     static void RegStatic() {
@@ -34,15 +41,20 @@ public:
         Register<EntityAttributesComponent>("EntityAttributesComponent");
     }
 
-    static std::unique_ptr<Component> Create(const std::string& name) {
+    // The created component's type id and ComponentTypes::TicksOf are stored
+    // in *id and *ticks when given
+    static std::unique_ptr<Component> Create(const std::string& name, ComponentTypeId* id = nullptr,
+                                             bool* ticks = nullptr) {
         auto it = registry().find(name);
         if (it != registry().end()) {
-            return it->second();
+            if (id) *id = it->second.id;
+            if (ticks) *ticks = it->second.ticks;
+            return it->second.create();
         }
         return nullptr;
     }
 
-    static std::string GetName(const std::type_index& type) {
+    static std::string GetName(ComponentTypeId type) {
         auto it = reverse().find(type);
         if (it != reverse().end()) return it->second;
         return "Unknown";
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Components are identified by a small integer, used as an index into each
+// Instance's component slots. The engine's own components have fixed ids known
+// at compile time; any other component type is numbered on first use.
+
+using ComponentTypeId = uint32_t;
+
+class TransformComponent;
+class HitboxComponent;
+class PhysicalPropertiesComponent;
+class HealthComponent;
+class EntityAttributesComponent;
+
+enum class BuiltinComponent : ComponentTypeId {
+    Transform,
+    Hitbox,
+    PhysicalProperties,
+    Health,
+    EntityAttributes,
+    Count
+};
+
+namespace ComponentTypes {
+
+// Upper bound on distinct component types, so per-instance flags fit a bitset
+constexpr ComponentTypeId MaxTypes = 64;
+
+// Specialised below for the exact built-in types only, so a class deriving from
+// one of them still gets an id of its own
+template <typename T>
+struct FixedId {
+    static constexpr bool fixed = false;
+};
+
+template <BuiltinComponent Id>
+struct Builtin {
+    static constexpr bool fixed = true;
+    static constexpr ComponentTypeId value = static_cast<ComponentTypeId>(Id);
+};
+
+template <> struct FixedId<TransformComponent> : Builtin<BuiltinComponent::Transform> {};
+template <> struct FixedId<HitboxComponent> : Builtin<BuiltinComponent::Hitbox> {};
+template <> struct FixedId<PhysicalPropertiesComponent> : Builtin<BuiltinComponent::PhysicalProperties> {};
+template <> struct FixedId<HealthComponent> : Builtin<BuiltinComponent::Health> {};
+template <> struct FixedId<EntityAttributesComponent> : Builtin<BuiltinComponent::EntityAttributes> {};
+
+// Components whose Tick does nothing, or whose state a world system updates,
+// declare `static constexpr bool Ticks = false;` and Instance::Tick skips them
+// without a virtual call. A subclass that does
+// override Tick has to set it back to true.
+template <typename T>
+constexpr bool TicksOf() {
+    if constexpr (requires { T::Ticks; }) return T::Ticks;
+    else return true;
+}
+
+inline ComponentTypeId NextDynamicId() {
+    static std::atomic<ComponentTypeId> next{ static_cast<ComponentTypeId>(BuiltinComponent::Count) };
+    ComponentTypeId id = next.fetch_add(1, std::memory_order_relaxed);
+    if (id >= MaxTypes)
+        throw std::runtime_error("[ComponentTypes] more than " + std::to_string(MaxTypes) + " component types");
+    return id;
+}
+
+template <typename T>
+inline ComponentTypeId IdOf() {
+    if constexpr (FixedId<T>::fixed) {
+        return FixedId<T>::value;
+    } else {
+        static const ComponentTypeId id = NextDynamicId();
+        return id;
+    }
+}
+
+} // namespace ComponentTypes
@@ -7,6 +7,7 @@ private:
     double moveSpeed = 1;
     bool canConsumeItems = false;
 public:
+    static constexpr bool Ticks = false;
 
     EntityAttributesComponent() = default;
     EntityAttributesComponent(double mvs, bool canConsumeItems): moveSpeed(mvs), canConsumeItems(canConsumeItems) {}
@@ -21,9 +22,6 @@ public:
         canConsumeItems = codec.Read<bool>();
     }
 
-    void Tick(float dt) override {
-    }
-
     std::string Dump() const override {
         return "EntityAttributesComponent()";
     }
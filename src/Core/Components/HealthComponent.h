@@ -1,71 +1,122 @@
 #pragma once
 
 #include "Component.h"
+#include "Core/World/DenseComponentStore.h"
 
+// Regenerates through its world's health system, never from its own Tick, so an
+// object outside a world keeps its health as it is
 class HealthComponent : public Component {
+public:
+    struct State {
+        int health = 100;
+        int maxHealth = 100;
+        int healAmount = 0;      // health regenerated per second
+        double regenCarry = 0.0; // regenerated but not yet a whole point
+        bool enabled = true;     // the component's, kept here for the health system
+    };
+    using Store = DenseComponentStore<State, HealthComponent>;
+
+    static constexpr bool Ticks = false;
+
+    // Scales with dt, so regen per second is the same whatever the tick rate
+    static void Regenerate(State& s, float dt) {
+        if (s.healAmount <= 0 || s.health >= s.maxHealth) {
+            s.regenCarry = 0.0;
+            return;
+        }
+        s.regenCarry += s.healAmount * static_cast<double>(dt);
+        int whole = static_cast<int>(s.regenCarry);
+        s.regenCarry -= whole;
+        if (whole > 0) s.health = std::min(s.health + whole, s.maxHealth);
+    }
+
 private:
-    int health;
-    int maxHealth;
-    int healAmount = 0;
+    // While bound, the state lives in the world's store and this copy is stale
+    State local;
+    Store* store = nullptr;
+    Store::Slot slot = Store::NullSlot;
+
+    State& Get() { return store ? store->Get(slot) : local; }
+    const State& Get() const { return store ? store->Get(slot) : local; }
+
+    void OnEnabledChanged() override { Get().enabled = enabled; }
 public:
-    HealthComponent(int maxHealth)
-        : health(maxHealth), maxHealth(maxHealth) {}
+    HealthComponent(int maxHealth) {
+        local.health = maxHealth;
+        local.maxHealth = maxHealth;
+    }
 
-    HealthComponent()
-        : health(100), maxHealth(100) {};
+    HealthComponent() = default;
+
+    ~HealthComponent() override {
+        if (store) store->Remove(slot);
+    }
 
-    int GetHealth() const { return health; }
-    int GetMaxHealth() const { return maxHealth; }
+    int GetHealth() const { return Get().health; }
+    int GetMaxHealth() const { return Get().maxHealth; }
 
     void SetHealth(int h) {
-        health = std::clamp(h, 0, maxHealth);
-        if (health == 0) {
+        State& s = Get();
+        s.health = std::clamp(h, 0, s.maxHealth);
+        if (s.health == 0) {
         }
     }
 
     void Heal(int amount) {
-        SetHealth(health + amount);
+        SetHealth(GetHealth() + amount);
     }
 
     void TakeDamage(int amount) {
-        SetHealth(health - amount);
+        SetHealth(GetHealth() - amount);
     }
 
     void SetMaxHealth(int amount) {
-        maxHealth = std::max(0, amount);
-        health = std::clamp(health, 0, maxHealth);
+        State& s = Get();
+        s.maxHealth = std::max(0, amount);
+        s.health = std::clamp(s.health, 0, s.maxHealth);
     }
 
     // Network encode/decode
     void Encode(PacketCodec& codec) const override {
-        codec.Write(health);
-        codec.Write(maxHealth);
-        codec.Write(healAmount);
+        const State& s = Get();
+        codec.Write(s.health);
+        codec.Write(s.maxHealth);
+        codec.Write(s.healAmount);
     }
 
     void Decode(PacketCodec& codec) override{
-        health = codec.Read<int>();
-        maxHealth = codec.Read<int>();
-        healAmount = codec.Read<int>();
+        State& s = Get();
+        s.health = codec.Read<int>();
+        s.maxHealth = codec.Read<int>();
+        s.healAmount = codec.Read<int>();
     }
 
     int GetHealAmount() const {
-        return healAmount;
+        return Get().healAmount;
     }
 
     void SetHealAmount(int amount) {
-        healAmount = amount;
+        Get().healAmount = amount;
     }
 
-    void Tick(float dt) override {
-        if (healAmount > 0 && health < maxHealth) {
-            Heal(healAmount);
+    // Moves the state into `newStore` (or back out of it when null)
+    void BindStore(Store* newStore, Store::Slot newSlot) {
+        if (newStore && newStore == store) {
+            slot = newSlot; // relocated within the same store
+            return;
         }
+        if (store) local = store->Get(slot);
+        store = newStore;
+        slot = newSlot;
+        if (store) store->Get(slot) = local;
     }
+    bool IsStored() const { return store != nullptr; }
+    Store::Slot GetStoreSlot() const { return slot; }
 
     std::string Dump() const override {
-        return "HealthComponent(health=" + std::to_string(health) +
-               ", maxHealth=" + std::to_string(maxHealth) +
-               ", healAmount=" + std::to_string(healAmount) + ")";
+        const State& s = Get();
+        return "HealthComponent(health=" + std::to_string(s.health) +
+               ", maxHealth=" + std::to_string(s.maxHealth) +
+               ", healAmount=" + std::to_string(s.healAmount) + ")";
     }
 };
\ No newline at end of file
@@ -10,30 +10,66 @@ class HitboxComponent : public Component {
 private:
     std::vector<Hitbox> hitboxes;
 
+    // Union of the hitboxes' filter bits, so whole objects can be rejected before their shapes are tested
+    CollisionMatrix::Mask categoryBits = 0;
+    CollisionMatrix::Mask maskBits = 0;
+    Rect2d localBounds;
+    uint32_t revision = 0;
+
+    void OnHitboxesChanged() {
+        ++revision;
+        categoryBits = maskBits = 0;
+        for (const auto& hb : hitboxes) {
+            categoryBits |= hb.categoryBits;
+            maskBits |= hb.maskBits;
+        }
+
+        localBounds = {};
+        if (!hitboxes.empty()) {
+            localBounds = hitboxes.front().shape.GetLocalBounds();
+            for (size_t i = 1; i < hitboxes.size(); ++i)
+                localBounds = localBounds.Union(hitboxes[i].shape.GetLocalBounds());
+        }
+        Changed.Fire();
+    }
+
 public:
+    static constexpr bool Ticks = false;
+
+    Signal<> Changed; // fired whenever the hitbox list is modified
+
     HitboxComponent() {
     }
 
-    void AddHitbox(std::unique_ptr<HitboxShape> shape, CollisionGroup group = CollisionGroup::DefaultCollidable, bool isTrigger = false) {
+    void AddHitbox(HitboxShape shape, CollisionGroup group = CollisionGroup::DefaultCollidable, bool isTrigger = false) {
         hitboxes.emplace_back(std::move(shape), group, isTrigger);
+        OnHitboxesChanged();
     }
 
     void ClearHitboxes() {
         hitboxes.clear();
+        OnHitboxesChanged();
     }
 
     const std::vector<Hitbox>& GetHitboxes() const {
         return hitboxes;
     }
 
+    CollisionMatrix::Mask GetCategoryBits() const { return categoryBits; }
+    CollisionMatrix::Mask GetMaskBits() const { return maskBits; }
+
+    // Union of every hitbox's local bounds, cached when the list changes; empty rect when there are no hitboxes.
+    const Rect2d& GetLocalBounds() const { return localBounds; }
+
+    // Bumped whenever the hitbox list changes, so copies can tell when they are stale
+    uint32_t GetRevision() const { return revision; }
+
     void Encode(PacketCodec& codec) const override {
         codec.Write<uint32_t>(static_cast<uint32_t>(hitboxes.size()));
         for (const auto& hb : hitboxes) {
-            auto& ref = *hb.shape;
-            std::string typeName = HitboxShapeRegistry::GetName(std::type_index(typeid(ref)));
-            codec.WriteString(typeName);
+            codec.WriteString(HitboxShapeRegistry::GetName(hb.shape.GetType()));
 
-            hb.shape->Encode(codec);
+            hb.shape.Encode(codec);
             codec.Write<bool>(hb.isTrigger);
             codec.Write<uint8_t>(static_cast<uint8_t>(hb.group));
         }
@@ -45,19 +81,20 @@ public:
         for (uint32_t i = 0; i < count; ++i) {
             std::string typeName = codec.ReadString();
 
-            auto shape = HitboxShapeRegistry::Create(typeName);
-            shape->Decode(codec);
+            HitboxShape shape = HitboxShapeRegistry::Create(typeName);
+            shape.Decode(codec);
 
             bool trigger = codec.Read<bool>();
             CollisionGroup group = static_cast<CollisionGroup>(codec.Read<uint8_t>());
             hitboxes.emplace_back(std::move(shape), group, trigger);
         }
+        OnHitboxesChanged();
     }
 
     std::string Dump() const override {
         std::string result = "HitboxComponent(hitboxes=[";
         for (const auto& hb : hitboxes) {
-            result += "{shape=" + hb.shape->ToString() +
+            result += "{shape=" + hb.shape.ToString() +
                       ", trigger=" + (hb.isTrigger ? "true" : "false") +
                       ", group=" + std::to_string(static_cast<int>(hb.group)) + "}, ";
         }
@@ -1,19 +1,43 @@
 #pragma once
 
 #include "Component.h"
+#include "Core/World/PhysicsBodyStore.h"
 
 class PhysicalPropertiesComponent : public Component {
 private:
     float mass = 1.0f; // Default to 1 to avoid divide-by-zero
     bool anchored = false;
+
+    // Mirrors mass and anchoring into the world's body store while bound
+    PhysicsBodyStore* bodies = nullptr;
+    PhysicsBodyStore::BodyId body = PhysicsBodyStore::NullBody;
+
+    void SyncBody() {
+        if (bodies) bodies->SetMassProperties(body, mass, anchored);
+    }
 public:
+    static constexpr bool Ticks = false;
+
+    Signal<bool> AnchoredChanged;
+
     PhysicalPropertiesComponent() = default;
     PhysicalPropertiesComponent(float m) : mass(std::max(0.001f, m)) {}
 
     float GetMass() const { return mass; }
-    void SetMass(float m) { mass = std::max(0.001f, m); } // Prevent zero mass
+    void SetMass(float m) { mass = std::max(0.001f, m); SyncBody(); } // Prevent zero mass
+
+    void SetAnchored(bool val) {
+        if (anchored == val) return;
+        anchored = val;
+        SyncBody();
+        AnchoredChanged.Fire(val);
+    }
 
-    void SetAnchored(bool val) { anchored = val; }
+    void BindBody(PhysicsBodyStore* store, PhysicsBodyStore::BodyId id) {
+        bodies = store;
+        body = id;
+        SyncBody();
+    }
     bool IsAnchored() const { return anchored; }
 
     void Encode(PacketCodec& codec) const override {
@@ -22,8 +46,8 @@ public:
     }
 
     void Decode(PacketCodec& codec) override {
-        mass = codec.Read<float>();
-        anchored = codec.Read<bool>();
+        SetMass(codec.Read<float>());
+        SetAnchored(codec.Read<bool>());
     }
 
     std::string Dump() const override {
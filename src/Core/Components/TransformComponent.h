@@ -1,6 +1,7 @@
 #pragma once
 #include "Component.h"
 #include "Util/GMath.h" // define simple float-based 2D vector
+#include "Core/World/PhysicsBodyStore.h"
 
 class TransformComponent : public Component {
 private:
@@ -10,13 +11,20 @@ private:
     Vector2d acceleration;
     float rotation; // in degrees
 
+    // While bound, position, velocity and acceleration live in the world's
+    // body store and the fields above are stale. Setting any of them wakes the body.
+    PhysicsBodyStore* bodies = nullptr;
+    PhysicsBodyStore::BodyId body = PhysicsBodyStore::NullBody;
+
 public:
+    static constexpr bool Ticks = false;
+
     TransformComponent();
     TransformComponent(const Vector2d& pos, const Vector2d& scl = {1.0f, 1.0f}, float rot = 0.0f);
 
     // Position
     void SetPosition(const Vector2d& pos);
-    const Vector2d& GetPosition() const;
+    Vector2d GetPosition() const;
     void Translate(const Vector2d& delta);
 
     // Rotation
@@ -25,11 +33,11 @@ public:
     void Rotate(float deltaDegrees);
 
     void SetVelocity(const Vector2d& vel);
-    const Vector2d& GetVelocity() const;
+    Vector2d GetVelocity() const;
     void Move(const Vector2d& delta);
     
     void Accelerate(const Vector2d& accel);
-    const Vector2d& GetAcceleration() const;
+    Vector2d GetAcceleration() const;
     void SetAcceleration(const Vector2d& accel);
 
     // Scale
@@ -38,29 +46,32 @@ public:
     void Scale(const Vector2d& factor);
 
     void Encode(PacketCodec& codec) const override {
-        codec.WriteVector2(position);
+        codec.WriteVector2(GetPosition());
         codec.WriteVector2(scale);
-        codec.WriteVector2(velocity);
-        codec.WriteVector2(acceleration);
+        codec.WriteVector2(GetVelocity());
+        codec.WriteVector2(GetAcceleration());
         codec.WriteFloat(rotation);
     }
 
     void Decode(PacketCodec& codec) override {
-        position = codec.ReadVector2();
+        SetPosition(codec.ReadVector2());
         scale = codec.ReadVector2();
-        velocity = codec.ReadVector2();
-        acceleration = codec.ReadVector2();
+        SetVelocity(codec.ReadVector2());
+        SetAcceleration(codec.ReadVector2());
         rotation = codec.Read<float>();
     }
 
+    // Moves position, velocity and acceleration into `store` (or back out of it when null)
+    void BindBody(PhysicsBodyStore* store, PhysicsBodyStore::BodyId id);
+
     // Helpers
     void ResetTransform();
 
     std::string Dump() const override {
-        return "TransformComponent(position=" + position.ToString() +
+        return "TransformComponent(position=" + GetPosition().ToString() +
                ", scale=" + scale.ToString() +
-               ", velocity=" + velocity.ToString() +
-               ", acceleration=" + acceleration.ToString() +
+               ", velocity=" + GetVelocity().ToString() +
+               ", acceleration=" + GetAcceleration().ToString() +
                ", rotation=" + std::to_string(rotation) + ")";
     }
 };
\ No newline at end of file
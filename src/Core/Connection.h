@@ -1,63 +1,176 @@
 #pragma once
-#include <functional>
-#include <vector>
 #include <algorithm>
-#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "SlabAllocator.h"
+
+// How Signal::Fire takes each argument: references and scalars as declared,
+// anything else by const reference, so firing never copies an argument
+template <typename T>
+using SignalParam = std::conditional_t<std::is_reference_v<T> || std::is_scalar_v<T>, T, const T&>;
 
 //
-// Connection: RAII-safe connection handle.
+// InlineCallback: move-only callable stored in place when it fits (lambdas
+// capturing up to four pointers, std::function), on the heap otherwise.
 //
-#include <iostream>
-#include <vector>
-#include <functional>
-#include <memory>
-#include <algorithm>
+template <typename Signature, size_t Capacity = 32>
+class InlineCallback;
+
+template <typename... Args, size_t Capacity>
+class InlineCallback<void(Args...), Capacity> {
+private:
+    struct Ops {
+        void (*invoke)(void* storage, SignalParam<Args>... args);
+        void (*move)(void* dst, void* src); // move-constructs dst from src and destroys src
+        void (*destroy)(void* storage);
+    };
+
+    template <typename F>
+    static constexpr bool FitsInline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static constexpr Ops InlineOps = {
+        [](void* s, SignalParam<Args>... args) { (*static_cast<F*>(s))(std::forward<SignalParam<Args>>(args)...); },
+        [](void* dst, void* src) { new (dst) F(std::move(*static_cast<F*>(src))); static_cast<F*>(src)->~F(); },
+        [](void* s) { static_cast<F*>(s)->~F(); }
+    };
+
+    template <typename F>
+    static constexpr Ops HeapOps = {
+        [](void* s, SignalParam<Args>... args) { (**static_cast<F**>(s))(std::forward<SignalParam<Args>>(args)...); },
+        [](void* dst, void* src) { *static_cast<F**>(dst) = *static_cast<F**>(src); },
+        [](void* s) { delete *static_cast<F**>(s); }
+    };
+
+    alignas(std::max_align_t) unsigned char storage[Capacity];
+    const Ops* ops = nullptr;
+
+public:
+    InlineCallback() = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineCallback>>>
+    InlineCallback(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (FitsInline<Fn>) {
+            new (storage) Fn(std::forward<F>(fn));
+            ops = &InlineOps<Fn>;
+        } else {
+            *reinterpret_cast<Fn**>(storage) = new Fn(std::forward<F>(fn));
+            ops = &HeapOps<Fn>;
+        }
+    }
+
+    InlineCallback(InlineCallback&& other) noexcept : ops(other.ops) {
+        if (ops) ops->move(storage, other.storage);
+        other.ops = nullptr;
+    }
+
+    InlineCallback& operator=(InlineCallback&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            ops = other.ops;
+            if (ops) ops->move(storage, other.storage);
+            other.ops = nullptr;
+        }
+        return *this;
+    }
+
+    InlineCallback(const InlineCallback&) = delete;
+    InlineCallback& operator=(const InlineCallback&) = delete;
+
+    ~InlineCallback() { Reset(); }
+
+    void Reset() {
+        if (ops) ops->destroy(storage);
+        ops = nullptr;
+    }
+
+    explicit operator bool() const { return ops != nullptr; }
+
+    void operator()(SignalParam<Args>... args) {
+        ops->invoke(storage, std::forward<SignalParam<Args>>(args)...);
+    }
+};
+
+//
+// Listener list shared by a Signal and the Connections to it. Refcounted
+// without atomics: like the Signal itself, it is only used by one thread at a time.
+//
+class SignalStateBase {
+public:
+    virtual ~SignalStateBase() = default;
+
+    // Pooled: every object owns several signals
+    static void* operator new(size_t size) { return SlabAllocator::Allocate(size); }
+    static void operator delete(void* block, size_t size) { SlabAllocator::Free(block, size); }
+
+    void AddRef() { ++refs; }
+    void Release() { if (--refs == 0) delete this; }
+
+    bool IsClosed() const { return closed; }
+    virtual void Disconnect(uint32_t id) = 0;
+
+protected:
+    uint32_t refs = 1; // the signal's, plus one per Connection and per Fire in progress
+    bool closed = false; // set when the signal is destroyed
+};
 
+//
+// Connection: RAII-safe connection handle.
+//
 class Connection {
 private:
-    std::weak_ptr<bool> valid_flag;
-    std::function<void()> disconnect_func;
+    SignalStateBase* state = nullptr;
+    uint32_t id = 0;
     bool auto_disconnect = true;
 
+    void Drop() {
+        if (state) state->Release();
+        state = nullptr;
+    }
+
 public:
     Connection() = default;
-    Connection(std::weak_ptr<bool> valid, std::function<void()> func, bool auto_disconnect = true)
-        : valid_flag(std::move(valid)), disconnect_func(std::move(func)), auto_disconnect(auto_disconnect) {}
+    Connection(SignalStateBase* state, uint32_t id, bool auto_disconnect = true)
+        : state(state), id(id), auto_disconnect(auto_disconnect) {
+        state->AddRef();
+    }
 
     // Move-only
     Connection(Connection&& other) noexcept
-        : valid_flag(std::move(other.valid_flag)),
-          disconnect_func(std::move(other.disconnect_func)),
-          auto_disconnect(other.auto_disconnect) {
+        : state(other.state), id(other.id), auto_disconnect(other.auto_disconnect) {
+        other.state = nullptr;
         other.auto_disconnect = false;
     }
 
     Connection& operator=(Connection&& other) noexcept {
         if (this != &other) {
             Disconnect();
-            valid_flag = std::move(other.valid_flag);
-            disconnect_func = std::move(other.disconnect_func);
+            state = other.state;
+            id = other.id;
             auto_disconnect = other.auto_disconnect;
+            other.state = nullptr;
             other.auto_disconnect = false;
         }
         return *this;
     }
 
+    // Safe during the signal's Fire, and after the signal is gone
     void Disconnect() {
-        if (auto flag = valid_flag.lock()) {
-            if (*flag && disconnect_func) {
-                disconnect_func();
-                *flag = false;
-            }
-        }
+        if (state && !state->IsClosed()) state->Disconnect(id);
+        Drop();
     }
 
     void Detach() { auto_disconnect = false; }
 
     ~Connection() {
-        if (auto_disconnect) {
-            Disconnect();
-        }
+        if (auto_disconnect) Disconnect();
+        else Drop();
     }
 
     Connection(const Connection&) = delete;
@@ -68,81 +181,158 @@ public:
 //
 // Signal: strongly typed, lightweight, event dispatcher.
 //
+// A signal nothing ever connected to is a null pointer, and firing it is one
+// branch. Listeners connected during Fire are first called by the next Fire;
+// listeners disconnected during Fire (including one-shots that just ran) are
+// skipped at once and removed when the outermost Fire returns. A listener may
+// destroy the signal it is being called from.
+//
 template <typename... Args>
 class Signal {
 private:
-    using Slot = std::function<void(Args...)>;
+    using Slot = InlineCallback<void(Args...)>;
+
     struct Listener {
-        size_t id;
+        uint32_t id;
+        bool once;
+        bool alive;
         Slot callback;
-        std::shared_ptr<bool> valid;
     };
 
-    std::vector<Listener> listeners;
-    size_t next_id = 0;
+    class State : public SignalStateBase {
+    public:
+        std::vector<Listener, SlabStlAllocator<Listener>> listeners;
+        std::vector<Listener, SlabStlAllocator<Listener>> added; // connected while firing
+        uint32_t firing = 0;
+        uint32_t dead = 0; // listeners marked for removal
+        uint32_t nextId = 0;
+
+        void Close() {
+            closed = true;
+            if (firing == 0) {
+                listeners.clear();
+                added.clear();
+            }
+        }
+
+        uint32_t Add(Slot callback, bool once) {
+            uint32_t id = nextId++;
+            auto& list = firing ? added : listeners;
+            list.push_back({ id, once, true, std::move(callback) });
+            return id;
+        }
+
+        void Disconnect(uint32_t id) override {
+            for (auto* list : { &listeners, &added }) {
+                for (auto& listener : *list) {
+                    if (listener.id != id || !listener.alive) continue;
+                    listener.alive = false;
+                    ++dead;
+                    if (firing == 0) Compact();
+                    return;
+                }
+            }
+        }
+
+        void DisconnectAll() {
+            for (auto* list : { &listeners, &added }) {
+                for (auto& listener : *list) {
+                    if (!listener.alive) continue;
+                    listener.alive = false;
+                    ++dead;
+                }
+            }
+            if (firing == 0) Compact();
+        }
+
+        void Fire(SignalParam<Args>... args) {
+            AddRef();
+            ++firing;
+            // Nothing reallocates listeners while firing, so references stay valid
+            for (size_t i = 0, count = listeners.size(); i < count && !closed; ++i) {
+                Listener& listener = listeners[i];
+                if (!listener.alive) continue;
+                if (listener.once) {
+                    listener.alive = false;
+                    ++dead;
+                }
+                listener.callback(std::forward<SignalParam<Args>>(args)...);
+            }
+            if (--firing == 0 && !closed) Compact();
+            Release();
+        }
+
+        void Compact() {
+            if (dead) {
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                    [](const Listener& l) { return !l.alive; }), listeners.end());
+            }
+            for (auto& listener : added)
+                if (listener.alive) listeners.push_back(std::move(listener));
+            added.clear();
+            dead = 0;
+        }
+    };
+
+    State* state = nullptr;
+
+    State& GetState() {
+        if (!state) state = new State();
+        return *state;
+    }
+
+    Connection AddListener(Slot callback, bool once, bool auto_disconnect) {
+        State& s = GetState();
+        return Connection(&s, s.Add(std::move(callback), once), auto_disconnect);
+    }
 
 public:
     Signal() = default;
-    ~Signal() = default;
+    ~Signal() {
+        if (!state) return;
+        state->Close();
+        state->Release();
+    }
+
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
 
     // Normal connection (RAII)
     Connection Connect(Slot callback) {
-        return AddListener(std::move(callback), true);
+        return AddListener(std::move(callback), false, true);
     }
 
     // Persistent connection (won’t auto-disconnect)
     Connection ConnectPersistent(Slot callback) {
-        return AddListener(std::move(callback), false);
+        return AddListener(std::move(callback), false, false);
     }
 
     // One-shot normal
     Connection ConnectOnce(Slot callback) {
-        return AddListenerOnce(std::move(callback), true);
+        return AddListener(std::move(callback), true, true);
     }
 
     // One-shot persistent
     Connection ConnectOncePersistent(Slot callback) {
-        return AddListenerOnce(std::move(callback), false);
+        return AddListener(std::move(callback), true, false);
     }
 
     // Emit (Fire): notify all listeners
-    void Fire(Args... args) {
-        for (auto& listener : listeners) {
-            if (*listener.valid) {
-                listener.callback(args...);
-            }
-        }
+    void Fire(SignalParam<Args>... args) {
+        if (!state) return;
+        if (!state->listeners.empty())
+            state->Fire(std::forward<SignalParam<Args>>(args)...);
     }
 
-    void Disconnect(size_t id) {
-        listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
-            [id](const Listener& l) { return l.id == id; }),
-            listeners.end());
+    bool HasListeners() const {
+        return state && state->listeners.size() + state->added.size() > state->dead;
     }
 
-    void DisconnectAll() {
-        listeners.clear();
+    void Disconnect(size_t id) {
+        if (state) state->Disconnect(static_cast<uint32_t>(id));
     }
 
-private:
-    Connection AddListener(Slot callback, bool auto_disconnect) {
-        auto valid_flag = std::make_shared<bool>(true);
-        const size_t id = next_id++;
-        listeners.push_back({ id, std::move(callback), valid_flag });
-        return Connection(valid_flag, [this, id]() { Disconnect(id); }, auto_disconnect);
-    }
-
-    Connection AddListenerOnce(Slot callback, bool auto_disconnect) {
-        auto valid_flag = std::make_shared<bool>(true);
-        const size_t id = next_id++;
-        listeners.push_back({
-            id,
-            [this, id, callback](Args... args) {
-                callback(args...);
-                Disconnect(id);
-            },
-            valid_flag
-        });
-        return Connection(valid_flag, [this, id]() { Disconnect(id); }, auto_disconnect);
+    void DisconnectAll() {
+        if (state) state->DisconnectAll();
     }
 };
@@ -6,8 +6,12 @@
 #include <typeindex>
 #include <unordered_map>
 #include <memory>
+#include <bitset>
 #include "../Util/UUID.hpp"
+#include "Components/ComponentTypes.h"
+#include "SlabAllocator.h"
 #include "Connection.h"
+#include "Tags.h"
 #include "../Common/Network/PacketCodec.h"
 
 class Component;
@@ -16,42 +20,67 @@ class World;
 using Util::UUID;
 
 class Instance {
+public:
+    using ComponentSlots = std::vector<std::unique_ptr<Component>, SlabStlAllocator<std::unique_ptr<Component>>>;
+
 protected:
-    using Tag = std::string;
-    std::vector<Tag> tags;
+    TagSet tags;
 
     UUID uuid;
-    std::unordered_map<std::type_index, std::shared_ptr<Component>> components;
-    std::unordered_map<std::type_index, bool> locked;
-    World* world;
+    // Indexed by ComponentTypeId; empty slots are null. Room for the built-in
+    // ids is reserved up front, dynamic ids grow it on demand.
+    ComponentSlots components;
+    std::bitset<ComponentTypes::MaxTypes> locked;
+    std::bitset<ComponentTypes::MaxTypes> ticking; // slots Tick visits
+    World* world = nullptr;
 
     bool destroyed = false;
     bool dirty = false;
+
+    void SetComponentSlot(ComponentTypeId id, std::unique_ptr<Component> comp) {
+        if (id >= components.size()) components.resize(id + 1);
+        components[id] = std::move(comp);
+        if (components[id]) OnComponentSet(id);
+    }
+
+    // Called after a tag is actually added or removed
+    virtual void OnTagChanged(TagId /*tag*/, bool /*added*/) {}
+    // Called after a component is added or replaced
+    virtual void OnComponentSet(ComponentTypeId /*id*/) {}
 public:
     Signal<> Destroyed;
 
-    Instance(): uuid(UUID::random()) {}
-    Instance(const UUID& id): uuid(id) {}
+    Instance(): uuid(UUID::random()) { components.reserve(static_cast<size_t>(BuiltinComponent::Count)); }
+    Instance(const UUID& id): uuid(id) { components.reserve(static_cast<size_t>(BuiltinComponent::Count)); }
     virtual ~Instance();
 
-    void AddTag(const Tag& tag) {
-        tags.push_back(tag);
+    // Objects are pooled, since they are spawned and destroyed at gameplay rates
+    static void* operator new(size_t size) { return SlabAllocator::Allocate(size); }
+    static void operator delete(void* block, size_t size) { SlabAllocator::Free(block, size); }
+
+    // Adding a tag the instance already has does nothing
+    void AddTag(TagId tag) {
+        if (tags.Add(tag)) OnTagChanged(tag, true);
     }
+    void AddTag(std::string_view tag) { AddTag(Tags::Intern(tag)); }
 
-    bool HasTag(const Tag& tag) const {
-        for (const auto& t : tags) {
-            if (t == tag) return true;
-        }
-        return false;
+    bool HasTag(TagId tag) const { return tags.Contains(tag); }
+    bool HasTag(std::string_view tag) const {
+        TagId id = Tags::Find(tag);
+        return id != Tags::Null && HasTag(id);
     }
 
-    void RemoveTag(const Tag& tag) {
-        tags.erase(std::remove(tags.begin(), tags.end(), tag), tags.end());
+    void RemoveTag(TagId tag) {
+        if (tags.Remove(tag)) OnTagChanged(tag, false);
     }
-    
+    void RemoveTag(std::string_view tag) {
+        TagId id = Tags::Find(tag);
+        if (id != Tags::Null) RemoveTag(id);
+    }
+
     virtual void Tick(float dt);
     UUID GetUUID() const { return uuid; }
-    const std::vector<Tag>& GetTags() const { return tags; }
+    const TagSet& GetTags() const { return tags; }
 
     virtual bool operator==(const Instance& other) const {
         return uuid == other.uuid;
@@ -64,9 +93,10 @@ public:
 
     bool IsDestroyed() const { return destroyed; }
 
-    const std::unordered_map<std::type_index, std::shared_ptr<Component>>& GetAllComponents() const {
+    // Component slots indexed by ComponentTypeId; skip the null ones
+    const ComponentSlots& GetAllComponents() const {
         if (destroyed) {
-            static std::unordered_map<std::type_index, std::shared_ptr<Component>> empty;
+            static const ComponentSlots empty;
             return empty;
         }
         return components;
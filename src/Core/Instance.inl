@@ -5,9 +5,9 @@
 template <typename T, typename... Args>
 T& Instance::AddComponent(Args&&... args) {
     static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
-    std::type_index typeIdx(typeid(T));
+    ComponentTypeId id = ComponentTypes::IdOf<T>();
 
-    if (locked[typeIdx]) {
+    if (locked[id]) {
         throw std::runtime_error("[Instance] Component of this type is locked and cannot be added.");
     }
 
@@ -15,32 +15,32 @@ T& Instance::AddComponent(Args&&... args) {
     T& ref = *comp;
 
     comp->OnAttach(this);
-    components[typeIdx] = std::move(comp);
-    
+    SetComponentSlot(id, std::move(comp));
+    ticking[id] = ComponentTypes::TicksOf<T>();
+
     return ref;
 }
 
 template <typename T>
 T* Instance::GetComponent() const {
-    std::type_index typeIdx(typeid(T));
-    auto it = components.find(typeIdx);
-    if (it != components.end())
-        return static_cast<T*>(it->second.get());
+    ComponentTypeId id = ComponentTypes::IdOf<T>();
+    if (id < components.size())
+        return static_cast<T*>(components[id].get());
     return nullptr;
 }
 
 template <typename T>
 void Instance::RemoveComponent() {
-    std::type_index typeIdx(typeid(T));
+    ComponentTypeId id = ComponentTypes::IdOf<T>();
 
-    if (locked[typeIdx] && !destroyed) {
+    if (locked[id] && !destroyed) {
         throw std::runtime_error("[Instance] Component of this type is locked and cannot be removed.");
     }
     
-    auto it = components.find(typeIdx);
-    if (it != components.end()) {
-        it->second->OnDetach();
-        components.erase(it);
+    if (id < components.size() && components[id]) {
+        components[id]->OnDetach();
+        components[id].reset();
+        ticking.reset(id);
     }
 }
 
@@ -53,5 +53,5 @@ bool Instance::HasComponent() const {
 template <typename T>
 void Instance::LockComponent() {
     static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
-    locked[typeid(T)] = true;
+    locked.set(ComponentTypes::IdOf<T>());
 }
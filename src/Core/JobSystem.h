@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+
+// Counts unfinished jobs. Scheduling a job against a counter raises it, and the
+// job finishing lowers it; jobs scheduled after a counter run once it reaches zero.
+// A counter must outlive every job scheduled against or after it.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    uint32_t GetPending() const { return pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    struct Continuation {
+        std::function<void()> fn;
+        JobCounter* counter;
+    };
+
+    std::atomic<uint32_t> pending{0};
+    std::mutex mutex; // guards continuations against the count reaching zero
+    std::vector<Continuation> continuations;
+};
+
+// Work-stealing job scheduler. Each worker owns a deque: it pushes and pops its
+// own jobs at the back, while idle workers steal from the front of the others'.
+// Jobs scheduled from outside the workers go through a shared queue. Waiting on
+// a counter runs queued jobs until the counter reaches zero, so waits can nest
+// (a job may wait on jobs it scheduled) and the waiting thread is never idle
+// while there is work. Jobs must not throw.
+class JobSystem {
+public:
+    // threads: workers started in addition to whichever threads wait on jobs.
+    // With 0 workers every job runs on the thread that waits for it.
+    explicit JobSystem(size_t threads);
+    // Runs whatever is still queued, then joins the workers
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    size_t GetWorkerCount() const { return workers.size(); }
+    // Workers plus the waiting thread
+    size_t GetThreadCount() const { return workers.size() + 1; }
+
+    void Schedule(std::function<void()> fn, JobCounter* counter = nullptr);
+    // Schedules fn once `dependency` reaches zero (right away if it already has).
+    // `counter` is raised immediately, so waiting on it also covers fn.
+    void ScheduleAfter(JobCounter& dependency, std::function<void()> fn, JobCounter* counter = nullptr);
+    // Runs queued jobs on this thread until the counter reaches zero
+    void Wait(JobCounter& counter);
+
+    // Calls fn(chunk) for every chunk in [0, chunks) and returns once all are done.
+    void Run(size_t chunks, const std::function<void(size_t)>& fn);
+
+    // Splits [0, count) into contiguous ranges of at least `grain` items and
+    // calls fn(begin, end) for each.
+    template <typename Fn>
+    void ParallelFor(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0) return;
+        size_t chunks = std::max<size_t>(1, std::min(count / std::max<size_t>(grain, 1), GetThreadCount() * 4));
+        Run(chunks, [&](size_t chunk) {
+            fn(count * chunk / chunks, count * (chunk + 1) / chunks);
+        });
+    }
+
+    // Jobs run so far, by any thread
+    uint64_t GetExecutedCount() const { return executed.load(std::memory_order_relaxed); }
+    // Jobs a worker took from another worker's deque
+    uint64_t GetStolenCount() const { return stolen.load(std::memory_order_relaxed); }
+
+private:
+    struct Job {
+        std::function<void()> fn;
+        JobCounter* counter;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    struct Worker {
+        Queue queue;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    Queue shared; // jobs scheduled from threads that are not workers
+
+    std::atomic<size_t> queued{0};
+    std::atomic<size_t> sleeping{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+
+    void Push(Job job);
+    // Own deque first, then the shared queue, then the other workers
+    bool TryPop(Job& job);
+    bool TryRunOne();
+    void Execute(Job& job);
+    void Finish(JobCounter* counter);
+    void WorkerLoop(size_t index);
+};
@@ -6,5 +6,7 @@ enum class CollisionGroup : uint8_t {
     DefaultCollidable,
     DefaultNonCollidable,
     Player,
-    Projectile
+    Projectile,
+
+    Count // number of groups, not a group
 };
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "Core/Components/HitboxComponent.h"
 #include "Core/Connection.h"
 #include "Core/Instance.h"
+#include "ObjectHandle.h"
+#include <atomic>
 #include <typeindex>
 
 using Util::UUID;
@@ -14,14 +16,37 @@ using Util::UUID;
 class GameObject : public Instance {
 protected:
     int id;
-    static int next_id;
+    static std::atomic<int> next_id; // objects are created on region worker threads too
 
     bool shouldDestroy;
     bool shouldRender = true;
+
+    int broadphaseProxy = -1; // handle into the owning World's broadphase, -1 when not registered
+    ObjectHandle handle;      // in the owning World, null when not in one
+    PhysicsBodyStore::BodyId physicsBody = PhysicsBodyStore::NullBody; // slot in the owning World's body store
+
+    // Copied from the HitboxComponent whenever its hitboxes change
+    CollisionMatrix::Mask collisionCategoryBits = 0;
+    CollisionMatrix::Mask collisionMaskBits = 0;
+    bool hasTriggers = false;
+    // Set on stand-ins for an object simulated elsewhere (ShardedWorld ghosts)
+    bool standIn = false;
+
+    void OnStaticGeometryChanged();
+    // Fires Moved, or leaves it to the world's event buffer while it is ticking
+    void NotifyMoved();
+    // Keeps the world's tag index current
+    void OnTagChanged(TagId tag, bool added) override;
+    // Hands components with a world system to the world's stores
+    void OnComponentSet(ComponentTypeId id) override;
 public:
     Signal<float> Ticked;
+    // Inside a world's tick, Moved, Collided, the trigger signals and Destroyed
+    // are held back and fired, coalesced, once its physics is done
     Signal<Vector2d> Moved;
     Signal<GameObject*> Collided;
+    Signal<GameObject*> TriggerEntered; // a pair with a trigger hitbox started touching
+    Signal<GameObject*> TriggerExited;
 
     GameObject();
     virtual ~GameObject();
@@ -36,8 +61,35 @@ public:
     void Move(const Vector2d& delta);
 
     bool ShouldTick() const { return true; };
+
+    // World-space bounds of all hitboxes. Inside a world these are read from its
+    // body store, which keeps them current as the object moves; the swept bounds
+    // also cover the path the physics expects the object to take this pass.
+    Rect2d GetWorldBounds() const;
+    Rect2d GetSweptBounds() const;
+
+    int GetBroadphaseProxy() const { return broadphaseProxy; }
+    void SetBroadphaseProxy(int proxy) { broadphaseProxy = proxy; }
     bool ShouldDestroy() const { return shouldDestroy; };
 
+    ObjectHandle GetHandle() const { return handle; }
+    void SetHandle(ObjectHandle h) { handle = h; }
+
+    PhysicsBodyStore::BodyId GetPhysicsBody() const { return physicsBody; }
+
+    // Union of the hitboxes' collision filter bits
+    CollisionMatrix::Mask GetCollisionCategoryBits() const { return collisionCategoryBits; }
+    CollisionMatrix::Mask GetCollisionMaskBits() const { return collisionMaskBits; }
+    // Whether any hitbox of this object may collide with any hitbox of `other`
+    bool CanCollideWith(const GameObject& other) const { return (collisionMaskBits & other.collisionCategoryBits) != 0; }
+    // Whether any hitbox is a trigger volume
+    bool HasTriggers() const { return hasTriggers; }
+    // A world reports collisions involving a stand-in to the stand-in only, which
+    // passes them on to the object it mirrors
+    bool IsStandIn() const { return standIn; }
+    // Points the transform and physical properties at a body store slot (or back at their own storage)
+    void BindPhysicsBody(PhysicsBodyStore* store, PhysicsBodyStore::BodyId id);
+
     void SetVelocity(const Vector2d& v);
     Vector2d GetVelocity() const;
 
@@ -51,6 +103,12 @@ public:
     HitboxComponent* GetHitbox() const;
     PhysicalPropertiesComponent* GetPhysicalProperties() const;
 
+    bool IsAnchored() const;
+
+    // Sleeping bodies are skipped by the world's physics until something wakes them
+    bool IsSleeping() const;
+    void Wake();
+
     void SetDirty(bool val = true) override;
 
     virtual void OnCollision(GameObject* other) {
@@ -1,15 +1,28 @@
 #pragma once
 
 #include "Core/Objects/CollisionGroups.h"
+#include "Core/World/CollisionMatrix.h"
 #include "HitboxShape.h"
 #include "Util/GMath.h"
-#include <memory>
+#include <stdexcept>
 
 struct Hitbox {
-    std::unique_ptr<HitboxShape> shape;
+    HitboxShape shape; // stored inline, no per-hitbox allocation
     bool isTrigger;
     CollisionGroup group;
 
-    Hitbox(std::unique_ptr<HitboxShape> s, CollisionGroup g, bool t = false)
-        : shape(std::move(s)), group(g), isTrigger(t) {}
+    // Filter bits resolved from the CollisionMatrix when the hitbox is created.
+    // Two hitboxes collide when (a.maskBits & b.categoryBits) != 0.
+    CollisionMatrix::Mask categoryBits;
+    CollisionMatrix::Mask maskBits;
+
+    Hitbox(HitboxShape s, CollisionGroup g, bool t = false)
+        : shape(std::move(s)), group(g), isTrigger(t) {
+        if (static_cast<size_t>(g) >= CollisionMatrix::GroupCount)
+            throw std::invalid_argument("[Hitbox] unknown collision group " + std::to_string(static_cast<int>(g)));
+        categoryBits = CollisionMatrix::CategoryBit(g);
+        maskBits = CollisionMatrix::GetMask(g);
+    }
+
+    bool CollidesWith(const Hitbox& other) const { return (maskBits & other.categoryBits) != 0; }
 };
\ No newline at end of file
@@ -1,24 +1,24 @@
 #pragma once
 
 #include "Common/Network/PacketCodec.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <string>
+#include <variant>
+#include <vector>
 
-enum class HitboxShapeType {
+enum class HitboxShapeType : uint8_t {
     Rectangle,
     Circle,
     Polygon
 };
 
-class HitboxShape {
-public:
-    virtual ~HitboxShape() = default;
-    virtual HitboxShapeType GetType() const = 0;
-    virtual std::string ToString() const = 0;
-    virtual void Encode(PacketCodec& codec) const = 0;
-    virtual void Decode(PacketCodec& codec) = 0;
-};
+// The concrete shapes are plain value types; HitboxShape below stores one of
+// them inline. Each provides GetLocalBounds (axis-aligned bounds relative to
+// the owner's position), ToString, Encode and Decode.
 
-class RectShape : public HitboxShape {
+class RectShape {
     Rect2d bounds;
     float rotation; // degrees or radians
 
@@ -26,26 +26,29 @@ public:
     RectShape(const Rect2d& b, float r = 0.0f) : bounds(b), rotation(r) {}
     RectShape(): bounds({0, 0, 1, 1}), rotation(0) {};
 
-    HitboxShapeType GetType() const override { return HitboxShapeType::Rectangle; }
+    static constexpr HitboxShapeType Type = HitboxShapeType::Rectangle;
+    HitboxShapeType GetType() const { return Type; }
     const Rect2d& GetBounds() const { return bounds; }
     float GetRotation() const { return rotation; }
 
-    void Encode(PacketCodec& codec) const override {
+    Rect2d GetLocalBounds() const { return bounds; }
+
+    void Encode(PacketCodec& codec) const {
         codec.WriteRect2(bounds);
         codec.Write<float>(rotation);
     }
 
-    void Decode(PacketCodec& codec) override {
+    void Decode(PacketCodec& codec) {
         bounds = codec.ReadRect2();
         rotation = codec.Read<float>();
     }
 
-    std::string ToString() const override {
+    std::string ToString() const {
         return "Rect(bounds=" + bounds.ToString() + ", rotation=" + std::to_string(rotation) + ")";
     }
 };
 
-class CircleShape : public HitboxShape {
+class CircleShape {
     Vector2d center;
     float radius;
 
@@ -53,9 +56,10 @@ public:
     CircleShape(const Vector2d& c, float r) : center(c), radius(r) {}
     CircleShape(): center(), radius() {}
 
-    HitboxShapeType GetType() const override { return HitboxShapeType::Circle; }
+    static constexpr HitboxShapeType Type = HitboxShapeType::Circle;
+    HitboxShapeType GetType() const { return Type; }
 
-    void Encode(PacketCodec& codec) const override {
+    void Encode(PacketCodec& codec) const {
         codec.WriteVector2(center);
         codec.Write<float>(radius);
     }
@@ -63,45 +67,145 @@ public:
     Vector2d GetCenter() const { return center; }
     float GetRadius() const { return radius; }
 
-    void Decode(PacketCodec& codec) override {
+    Rect2d GetLocalBounds() const {
+        return { center.x - radius, center.y - radius, 2.0 * radius, 2.0 * radius };
+    }
+
+    void Decode(PacketCodec& codec) {
         center = codec.ReadVector2();
         radius = codec.Read<float>();
     }
 
-    std::string ToString() const override {
+    std::string ToString() const {
         return "Circle(center=" + center.ToString() + ", radius=" + std::to_string(radius) + ")";
     }
 };
 
-class PolygonShape : public HitboxShape {
-    std::vector<Vector2d> vertices;
+class PolygonShape {
+    std::vector<Vector2d> vertices; // convex, either winding
+
+    // Derived from the vertices whenever they change. The axes are the unit edge
+    // normals with parallel duplicates dropped; axisMin/axisMax hold the polygon's
+    // own projection onto each, so the narrowphase never renormalizes or reprojects them.
+    std::vector<Vector2d> axes;
+    std::vector<double> axisMin, axisMax;
+    Rect2d bounds;
+
+    void Rebuild() {
+        axes.clear();
+        axisMin.clear();
+        axisMax.clear();
+        bounds = {};
+        if (vertices.empty()) return;
+
+        Vector2d lo = vertices[0], hi = vertices[0];
+        for (const auto& v : vertices) {
+            lo.x = std::min(lo.x, v.x); lo.y = std::min(lo.y, v.y);
+            hi.x = std::max(hi.x, v.x); hi.y = std::max(hi.y, v.y);
+        }
+        bounds = { lo.x, lo.y, hi.x - lo.x, hi.y - lo.y };
+
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            Vector2d e = vertices[(i + 1) % vertices.size()] - vertices[i];
+            Vector2d axis = Vector2d{ -e.y, e.x }.Normalized();
+            if (axis.LengthSquared() == 0.0) continue;
+
+            bool parallel = false;
+            for (const auto& other : axes)
+                parallel |= std::abs(axis.x * other.y - axis.y * other.x) < 1e-9;
+            if (parallel) continue;
+
+            double pMin = INFINITY, pMax = -INFINITY;
+            for (const auto& v : vertices) {
+                double p = v.Dot(axis);
+                pMin = std::min(pMin, p);
+                pMax = std::max(pMax, p);
+            }
+            axes.push_back(axis);
+            axisMin.push_back(pMin);
+            axisMax.push_back(pMax);
+        }
+    }
 
 public:
-    PolygonShape(const std::vector<Vector2d>& verts) : vertices(verts) {}
+    PolygonShape(const std::vector<Vector2d>& verts) : vertices(verts) { Rebuild(); }
     PolygonShape(): vertices() {}
 
-    HitboxShapeType GetType() const override { return HitboxShapeType::Polygon; }
+    static constexpr HitboxShapeType Type = HitboxShapeType::Polygon;
+    HitboxShapeType GetType() const { return Type; }
 
-    void Encode(PacketCodec& codec) const override {
+    void Encode(PacketCodec& codec) const {
         codec.Write<uint32_t>(vertices.size());
         for (const auto& v : vertices) codec.WriteVector2(v);
     }
 
-    void Decode(PacketCodec& codec) override {
+    void Decode(PacketCodec& codec) {
         uint32_t count = codec.Read<uint32_t>();
         vertices.clear();
         for (uint32_t i = 0; i < count; ++i) {
             vertices.push_back(codec.ReadVector2());
         }
+        Rebuild();
     }
 
-    std::vector<Vector2d> GetVertices() const { return vertices; }
+    const std::vector<Vector2d>& GetVertices() const { return vertices; }
+    const std::vector<Vector2d>& GetAxes() const { return axes; }
+    const std::vector<double>& GetAxisMin() const { return axisMin; }
+    const std::vector<double>& GetAxisMax() const { return axisMax; }
+
+    Rect2d GetLocalBounds() const { return bounds; }
 
-    std::string ToString() const override {
+    std::string ToString() const {
         std::string result = "Polygon(vertices=[";
         for (const auto& v : vertices) result += v.ToString() + ", ";
         if (!vertices.empty()) result.pop_back(), result.pop_back();
         result += "])";
         return result;
     }
-};
\ No newline at end of file
+};
+
+// A hitbox shape held by value. The variant's alternatives are listed in
+// HitboxShapeType order, so its index is the type tag and pair dispatch can
+// index a table with it instead of making virtual calls.
+class HitboxShape {
+public:
+    using Storage = std::variant<RectShape, CircleShape, PolygonShape>;
+    static constexpr size_t TypeCount = std::variant_size_v<Storage>;
+
+    HitboxShape() = default;
+    HitboxShape(const RectShape& s) : shape(s) {}
+    HitboxShape(const CircleShape& s) : shape(s) {}
+    HitboxShape(PolygonShape s) : shape(std::move(s)) {}
+
+    // Accepts the heap-allocated shapes older call sites build; the shape is moved inline
+    template <typename T>
+    HitboxShape(std::unique_ptr<T> s) : HitboxShape(std::move(*s)) {}
+
+    HitboxShapeType GetType() const { return static_cast<HitboxShapeType>(shape.index()); }
+
+    template <typename T>
+    bool Is() const { return std::holds_alternative<T>(shape); }
+
+    // nullptr when the shape is of another type
+    template <typename T>
+    const T* GetIf() const { return std::get_if<T>(&shape); }
+
+    // Unchecked: the caller has already dispatched on GetType()
+    template <typename T>
+    const T& As() const { return *std::get_if<T>(&shape); }
+
+    template <typename Fn>
+    decltype(auto) Visit(Fn&& fn) const { return std::visit(std::forward<Fn>(fn), shape); }
+
+    Rect2d GetLocalBounds() const { return Visit([](const auto& s) { return s.GetLocalBounds(); }); }
+    std::string ToString() const { return Visit([](const auto& s) { return s.ToString(); }); }
+    void Encode(PacketCodec& codec) const { Visit([&codec](const auto& s) { s.Encode(codec); }); }
+    void Decode(PacketCodec& codec) { std::visit([&codec](auto& s) { s.Decode(codec); }, shape); }
+
+private:
+    Storage shape;
+};
+
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<size_t>(RectShape::Type), HitboxShape::Storage>, RectShape>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<size_t>(CircleShape::Type), HitboxShape::Storage>, CircleShape>);
+static_assert(std::is_same_v<std::variant_alternative_t<static_cast<size_t>(PolygonShape::Type), HitboxShape::Storage>, PolygonShape>);
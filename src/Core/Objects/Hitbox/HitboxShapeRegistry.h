@@ -1,28 +1,29 @@
 #pragma once
 
 #include "HitboxShape.h"
+#include <array>
 #include <functional>
-#include <memory>
-#include <typeindex>
+#include <stdexcept>
+#include <unordered_map>
 
 class HitboxShapeRegistry {
-    using Factory = std::function<std::unique_ptr<HitboxShape>()>;
+    using Factory = std::function<HitboxShape()>;
 
     static std::unordered_map<std::string, Factory>& registry() {
         static std::unordered_map<std::string, Factory> inst;
         return inst;
     }
 
-    static std::unordered_map<std::type_index, std::string>& reverse() {
-        static std::unordered_map<std::type_index, std::string> inst;
+    static std::array<std::string, HitboxShape::TypeCount>& reverse() {
+        static std::array<std::string, HitboxShape::TypeCount> inst;
         return inst;
     }
 
 public:
     template<typename T>
     static void Register(const std::string& name) {
-        registry()[name] = []() { return std::make_unique<T>(); };
-        reverse()[std::type_index(typeid(T))] = name;
+        registry()[name] = []() { return HitboxShape(T{}); };
+        reverse()[static_cast<size_t>(T::Type)] = name;
     }
 
     static void RegStatic() {
@@ -31,18 +32,17 @@ public:
         Register<PolygonShape>("PolygonShape");
     }
 
-    static std::unique_ptr<HitboxShape> Create(const std::string& name) {
+    static HitboxShape Create(const std::string& name) {
         auto it = registry().find(name);
         if (it != registry().end()) {
             return it->second();
         }
-        return nullptr;
+        throw std::runtime_error("[HitboxShapeRegistry] unknown shape " + name);
     }
 
-    static std::string GetName(const std::type_index& type) {
-        auto it = reverse().find(type);
-        if (it != reverse().end()) return it->second;
-        return "Unknown";
+    static std::string GetName(HitboxShapeType type) {
+        const std::string& name = reverse()[static_cast<size_t>(type)];
+        return name.empty() ? "Unknown" : name;
     }
 
     static std::string RegDump() {
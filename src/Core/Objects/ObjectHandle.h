@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+// Refers to an object in a World by slot and generation. A slot is reused once
+// its object leaves the world, under a new generation, so a stale handle
+// resolves to nullptr rather than to whatever took the slot over.
+struct ObjectHandle {
+    static constexpr uint32_t NullIndex = UINT32_MAX;
+
+    uint32_t index = NullIndex;
+    uint32_t generation = 0;
+
+    bool IsNull() const { return index == NullIndex; }
+    bool operator==(const ObjectHandle&) const = default;
+};
@@ -8,7 +8,7 @@ class LogicalPlayer : public Instance {
 private:
     int playerID;
     std::string name;
-    PlayerEntity* controlledEntity;
+    PlayerEntity* controlledEntity = nullptr;
 
 public:
     Signal<> OnEntityUnassigned;
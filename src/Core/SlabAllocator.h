@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pool allocator for engine objects that are created and destroyed at gameplay
+// rates (objects, their components and component slots). Requests are rounded
+// up to a size class, 16-byte steps up to MaxBlockSize; each class keeps a free
+// list threaded through its freed blocks and is refilled a slab at a time, so
+// every object type effectively gets its own pool. Freed blocks are reused by
+// the next allocation of the same class and never handed back to the system.
+// Larger requests go straight to operator new. Thread-safe.
+class SlabAllocator {
+public:
+    static constexpr size_t Granularity = 16;
+    static constexpr size_t MaxBlockSize = 1024;
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    struct Stats {
+        uint64_t allocations = 0;       // blocks handed out, pooled or not
+        uint64_t systemAllocations = 0; // slabs and oversized blocks taken from operator new
+        uint64_t liveBlocks = 0;        // handed out and not yet freed
+    };
+
+    static void* Allocate(size_t size);
+    // size must be the one passed to Allocate
+    static void Free(void* block, size_t size) noexcept;
+
+    // Process-wide totals
+    static Stats GetStats();
+};
+
+// Standard allocator over SlabAllocator, for containers owned by pooled objects
+template <typename T>
+struct SlabStlAllocator {
+    using value_type = T;
+
+    SlabStlAllocator() = default;
+    template <typename U>
+    SlabStlAllocator(const SlabStlAllocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(SlabAllocator::Allocate(n * sizeof(T))); }
+    void deallocate(T* p, size_t n) noexcept { SlabAllocator::Free(p, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const SlabStlAllocator<U>&) const { return true; }
+};
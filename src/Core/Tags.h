@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "SlabAllocator.h"
+
+// Tags are interned into 16-bit atoms through a process-wide table, so objects
+// store and compare small integers instead of strings. The engine's own tags
+// have fixed atoms, the same in every process; any other name gets the next
+// free atom on first use, so its number is only meaningful locally.
+
+using TagId = uint16_t;
+
+enum class BuiltinTag : TagId {
+    Player,
+    Count
+};
+
+namespace Tags {
+
+constexpr TagId Null = 0xffff;
+
+inline constexpr TagId Of(BuiltinTag tag) { return static_cast<TagId>(tag); }
+// Fixed atoms mean the same on both ends of a connection; others go with their name
+inline constexpr bool IsBuiltin(TagId tag) { return tag < static_cast<TagId>(BuiltinTag::Count); }
+
+// The atom for name, interning it if needed. Thread safe.
+TagId Intern(std::string_view name);
+// The atom for name, or Null if it was never interned
+TagId Find(std::string_view name);
+// The interned name; the reference stays valid for the life of the process
+const std::string& GetName(TagId tag);
+
+}
+
+// An object's tags, without duplicates, in the order they were added. The first
+// few are stored in place; objects with more spill into a pooled array.
+class TagSet {
+public:
+    static constexpr size_t InlineCapacity = 6;
+
+    const TagId* begin() const { return size <= InlineCapacity ? local.data() : spill.data(); }
+    const TagId* end() const { return begin() + size; }
+    size_t Size() const { return size; }
+    bool Empty() const { return size == 0; }
+
+    bool Contains(TagId tag) const {
+        return std::find(begin(), end(), tag) != end();
+    }
+
+    // False if the tag was already there
+    bool Add(TagId tag) {
+        if (Contains(tag)) return false;
+        if (size < InlineCapacity) {
+            local[size] = tag;
+        } else {
+            if (size == InlineCapacity) spill.assign(local.begin(), local.end());
+            spill.push_back(tag);
+        }
+        ++size;
+        return true;
+    }
+
+    // False if the tag was not there
+    bool Remove(TagId tag) {
+        TagId* data = size <= InlineCapacity ? local.data() : spill.data();
+        TagId* found = std::find(data, data + size, tag);
+        if (found == data + size) return false;
+        std::copy(found + 1, data + size, found);
+        --size;
+        if (size >= InlineCapacity) spill.pop_back();
+        if (size == InlineCapacity) {
+            std::copy(spill.begin(), spill.end(), local.begin());
+            spill.clear();
+        }
+        return true;
+    }
+
+private:
+    std::array<TagId, InlineCapacity> local{};
+    std::vector<TagId, SlabStlAllocator<TagId>> spill; // all tags, once there are more than fit in local
+    uint16_t size = 0;
+};
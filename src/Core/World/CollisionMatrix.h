@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/Objects/CollisionGroups.h"
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <unordered_map>
 #include <string>
@@ -9,10 +11,27 @@
 
 using json = nlohmann::json;
 
+// Which collision groups collide with which. Stored as one bit mask per
+// group (bit n set = collides with group n), so a pair test is a single AND.
+// Symmetric: Set() always updates both groups' masks.
 class CollisionMatrix {
+public:
+    using Mask = uint32_t;
+    static constexpr size_t GroupCount = static_cast<size_t>(CollisionGroup::Count);
+    static_assert(GroupCount <= sizeof(Mask) * 8, "CollisionMatrix::Mask is too narrow for every CollisionGroup");
+
 private:
-    static inline std::unordered_map<CollisionGroup,
-        std::unordered_map<CollisionGroup, bool>> matrix;
+    // Until configured, everything collides except DefaultNonCollidable
+    static constexpr std::array<Mask, GroupCount> DefaultMasks() {
+        std::array<Mask, GroupCount> result{};
+        Mask all = ~Mask(0) >> (sizeof(Mask) * 8 - GroupCount);
+        Mask none = CategoryBit(CollisionGroup::DefaultNonCollidable);
+        for (size_t g = 0; g < GroupCount; ++g)
+            result[g] = g == static_cast<size_t>(CollisionGroup::DefaultNonCollidable) ? 0 : (all & ~none);
+        return result;
+    }
+
+    static inline std::array<Mask, GroupCount> masks = DefaultMasks();
 
     static CollisionGroup FromString(const std::string& name) {
         static const std::unordered_map<std::string, CollisionGroup> map = {
@@ -27,6 +46,12 @@ private:
     }
 
 public:
+    static constexpr Mask CategoryBit(CollisionGroup group) {
+        return Mask(1) << static_cast<uint8_t>(group);
+    }
+
+    // Replaces the whole table: only the pairs listed in the file collide.
+    // Hitboxes capture their group's mask when created, so load this before spawning anything.
     static void LoadFromFile(const std::string& path) {
         std::ifstream file(path);
         if (!file.is_open()) {
@@ -36,6 +61,7 @@ public:
         json data;
         file >> data;
 
+        masks.fill(0);
         for (auto& [groupName, collidesWith] : data.items()) {
             CollisionGroup g1 = FromString(groupName);
             for (const auto& otherName : collidesWith) {
@@ -48,23 +74,29 @@ public:
     }
 
     static void Set(CollisionGroup a, CollisionGroup b, bool value) {
-        matrix[a][b] = value;
-        matrix[b][a] = value;
+        size_t ia = static_cast<size_t>(a), ib = static_cast<size_t>(b);
+        if (value) {
+            masks[ia] |= CategoryBit(b);
+            masks[ib] |= CategoryBit(a);
+        } else {
+            masks[ia] &= ~CategoryBit(b);
+            masks[ib] &= ~CategoryBit(a);
+        }
     }
 
+    static void Reset() { masks = DefaultMasks(); }
+
+    static Mask GetMask(CollisionGroup group) { return masks[static_cast<size_t>(group)]; }
+
     static bool ShouldCollide(CollisionGroup a, CollisionGroup b) {
-        auto it1 = matrix.find(a);
-        if (it1 == matrix.end()) return false;
-        auto it2 = it1->second.find(b);
-        if (it2 == it1->second.end()) return false;
-        return it2->second;
+        return (masks[static_cast<size_t>(a)] & CategoryBit(b)) != 0;
     }
 
     static void PrintMatrix() {
-        for (auto& [a, pairs] : matrix) {
-            std::cout << "Group " << (int)a << " collides with: ";
-            for (auto& [b, val] : pairs)
-                if (val) std::cout << (int)b << " ";
+        for (size_t a = 0; a < GroupCount; ++a) {
+            std::cout << "Group " << a << " collides with: ";
+            for (size_t b = 0; b < GroupCount; ++b)
+                if (masks[a] & (Mask(1) << b)) std::cout << b << " ";
             std::cout << std::endl;
         }
     }
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Core/Objects/Hitbox/Hitbox.h"
+#include "Util/GMath.h"
+
+class GameObject;
+
+// Earliest time of impact found between two objects over a sweep interval.
+struct Contact {
+    GameObject* a = nullptr;
+    GameObject* b = nullptr;
+    const Hitbox* hitboxA = nullptr;
+    const Hitbox* hitboxB = nullptr;
+
+    double time = 0.0;         // seconds from the start of the interval
+    Vector2d normal = {0, 0};  // points from A -> B
+    bool isTrigger = false;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Util/GMath.h"
+#include "Core/SlabAllocator.h"
+#include "Core/Objects/ObjectHandle.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+// Contacts resolved on recent ticks, keyed by object pair and hitbox pair, so
+// a contact that persists into the next tick can be warm-started with the
+// normal impulse it needed last time. Entries are kept in a dense array in
+// insertion order, so walking them is deterministic; the map only finds them.
+// Objects are keyed by their generational handles: an entry for an object that
+// left the world never matches whatever reuses its slot, and simply expires.
+class ContactCache {
+public:
+    struct Key {
+        ObjectHandle a; // resolve through the world; null once the object left it
+        ObjectHandle b;
+        uint32_t hitboxA; // index into the owner's hitbox list
+        uint32_t hitboxB;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct Entry {
+        Key key;
+        Vector2d normal;            // from b towards a, for the key's order
+        double impulse = 0.0;       // normal impulse accumulated this tick
+        double warmImpulse = 0.0;   // what the previous tick accumulated; 0 if it did not touch
+        uint64_t lastTick = 0;      // last tick an impulse was recorded
+    };
+
+    // Starts a new tick: moves each entry's impulse into warmImpulse and drops
+    // entries that have not been touched for more than expiryTicks ticks.
+    void BeginTick(uint32_t expiryTicks);
+
+    // Adds an impulse applied along normal (pointing from b towards a) this tick.
+    // The pair may be given in either order.
+    void Record(ObjectHandle a, ObjectHandle b, uint32_t hitboxA, uint32_t hitboxB,
+                const Vector2d& normal, double impulse);
+
+    void Clear();
+
+    size_t Size() const { return entries.size(); }
+    const std::vector<Entry>& GetEntries() const { return entries; }
+    // The entry keeps its stored order, so compare its key before reading the normal
+    const Entry* Find(ObjectHandle a, ObjectHandle b, uint32_t hitboxA, uint32_t hitboxB) const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& k) const noexcept {
+            size_t h = static_cast<size_t>(k.a.index) << 32 | k.a.generation;
+            h ^= (static_cast<size_t>(k.b.index) << 32 | k.b.generation) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            h ^= (static_cast<size_t>(k.hitboxA) << 32 | k.hitboxB) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    // Orders the pair by handle so (a, b) and (b, a) share an entry; returns whether it swapped
+    static bool Canonicalize(Key& key);
+    void Erase(size_t index);
+
+    std::vector<Entry> entries;
+    // Pooled nodes, so contacts coming and going do not touch the heap
+    std::unordered_map<Key, uint32_t, KeyHash, std::equal_to<Key>,
+                       SlabStlAllocator<std::pair<const Key, uint32_t>>> lookup;
+    uint64_t tick = 0;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// State of one component type for every object in a World that has it, packed
+// into a single array so a system can update all of it in one linear pass
+// instead of a virtual Tick per component. While bound, a component reads and
+// writes its state through its slot. Removal moves the last entry into the
+// freed slot, so the array stays dense.
+//
+// Owner must provide BindStore(DenseComponentStore*, Slot), called with the
+// new slot when bound or relocated, and with nullptr when unbound. A component
+// copies its state in when bound and back out when unbound, like the
+// PhysicsBodyStore bindings.
+template <typename Data, typename Owner>
+class DenseComponentStore {
+public:
+    using Slot = uint32_t;
+    static constexpr Slot NullSlot = UINT32_MAX;
+
+    Slot Add(Owner* owner) {
+        Slot slot = static_cast<Slot>(owners.size());
+        values.emplace_back();
+        owners.push_back(owner);
+        owner->BindStore(this, slot);
+        return slot;
+    }
+
+    void Remove(Slot slot) {
+        owners[slot]->BindStore(nullptr, NullSlot);
+
+        Slot last = static_cast<Slot>(owners.size() - 1);
+        if (slot != last) {
+            values[slot] = values[last];
+            owners[slot] = owners[last];
+            owners[slot]->BindStore(this, slot);
+        }
+        values.pop_back();
+        owners.pop_back();
+    }
+
+    void Clear() {
+        while (!owners.empty())
+            Remove(static_cast<Slot>(owners.size() - 1));
+    }
+
+    size_t Size() const { return owners.size(); }
+    Data& Get(Slot slot) { return values[slot]; }
+    const Data& Get(Slot slot) const { return values[slot]; }
+    Owner* GetOwner(Slot slot) const { return owners[slot]; }
+
+    // values[i] belongs to GetOwner(i)
+    std::vector<Data>& GetValues() { return values; }
+    const std::vector<Data>& GetValues() const { return values; }
+
+private:
+    std::vector<Data> values;
+    std::vector<Owner*> owners;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "IBroadphase.h"
+
+// Incremental bounding volume hierarchy. Leaves store a fattened copy of the
+// proxy AABB so small movements do not touch the tree; a leaf is only removed
+// and re-inserted once its tight AABB escapes the fat one. Handles large size
+// spreads (long walls next to small projectiles) far better than a uniform grid.
+//
+// Pairs whose fat AABBs overlap are kept between QueryPairs calls. Only proxies
+// created, re-inserted or destroyed since the last call are looked up in the
+// tree again; the others keep their pairs.
+class DynamicAABBTree : public IBroadphase {
+public:
+    explicit DynamicAABBTree(double margin = 4.0);
+
+    ProxyId CreateProxy(const Rect2d& aabb, GameObject* object) override;
+    void DestroyProxy(ProxyId id) override;
+    void MoveProxy(ProxyId id, const Rect2d& aabb) override;
+
+    const Rect2d& GetAABB(ProxyId id) const override { return nodes[id].tight; }
+    const Rect2d& GetFatAABB(ProxyId id) const { return nodes[id].aabb; }
+    GameObject* GetObject(ProxyId id) const override { return nodes[id].object; }
+
+    void QueryPairs(std::vector<ProxyPair>& out) override;
+    void QueryRegion(const Rect2d& region, std::vector<ProxyId>& out) const override;
+    void QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                  std::vector<ProxyId>& out) const override;
+
+    void Clear() override;
+
+    void SetMargin(double m) { margin = m; }
+    double GetMargin() const { return margin; }
+
+    int GetHeight() const { return root == NullNode ? 0 : nodes[root].height; }
+
+private:
+    static constexpr int32_t NullNode = -1;
+    // How many moves' worth of displacement a re-inserted leaf is fattened ahead by
+    static constexpr double AabbMultiplier = 4.0;
+
+    struct Node {
+        Rect2d aabb;  // fat bounds for leaves, union of children otherwise
+        Rect2d tight; // leaves only: the AABB last given by the caller
+        GameObject* object = nullptr;
+
+        int32_t parent = NullNode; // doubles as the free list link
+        int32_t child1 = NullNode;
+        int32_t child2 = NullNode;
+        int32_t height = -1;       // leaf = 0, free node = -1
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    std::vector<Node> nodes;
+    int32_t root = NullNode;
+    int32_t freeList = NullNode;
+    double margin;
+
+    std::vector<ProxyPair> fatPairs;  // leaves whose fat AABBs overlap, first < second, sorted
+    std::vector<int32_t> moveBuffer;  // node ids whose pairs are out of date
+    std::vector<uint8_t> moved;       // by node id: whether it is in moveBuffer
+    std::vector<ProxyPair> newPairs;  // scratch for UpdatePairs
+
+    void MarkMoved(int32_t id);
+    // Brings fatPairs up to date with the move buffer
+    void UpdatePairs();
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t id);
+
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t a);
+    void Refit(int32_t index);
+
+    template <typename Descend, typename Visit>
+    void Traverse(Descend&& descend, Visit&& visit) const;
+};
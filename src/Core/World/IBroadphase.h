@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Util/GMath.h"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class GameObject;
+
+// Common interface for World's broadphase structures. A proxy is one AABB
+// tracked on behalf of a GameObject; the ids are only meaningful to the
+// structure that issued them.
+class IBroadphase {
+public:
+    using ProxyId = int32_t;
+    using ProxyPair = std::pair<ProxyId, ProxyId>;
+    static constexpr ProxyId NullProxy = -1;
+
+    virtual ProxyId CreateProxy(const Rect2d& aabb, GameObject* object) = 0;
+    virtual void DestroyProxy(ProxyId id) = 0;
+    virtual void MoveProxy(ProxyId id, const Rect2d& aabb) = 0;
+
+    virtual const Rect2d& GetAABB(ProxyId id) const = 0;
+    virtual GameObject* GetObject(ProxyId id) const = 0;
+
+    // Appends every pair of proxies whose AABBs overlap, each pair once with
+    // first < second, sorted ascending so results do not depend on layout.
+    // Structures may bring cached pair state up to date here.
+    virtual void QueryPairs(std::vector<ProxyPair>& out) = 0;
+
+    // Appends every proxy whose AABB overlaps the region.
+    virtual void QueryRegion(const Rect2d& region, std::vector<ProxyId>& out) const = 0;
+
+    // Appends every proxy whose AABB is crossed by the segment
+    // origin + dir * t, t in [0, maxDistance]. dir must be normalized.
+    virtual void QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                          std::vector<ProxyId>& out) const = 0;
+
+    virtual void Clear() = 0;
+
+    virtual ~IBroadphase() = default;
+};
+
+// Slab test of the segment origin + dir * t, t in [0, maxDistance], against an AABB.
+// tEntry receives the distance at which the segment enters the box (0 if it starts inside).
+inline bool RayOverlapsAABB(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                            const Rect2d& box, double& tEntry) {
+    double tMin = 0.0;
+    double tMax = maxDistance;
+
+    const double o[2] = { origin.x, origin.y };
+    const double d[2] = { dir.x, dir.y };
+    const double lo[2] = { box.Left(), box.Top() };
+    const double hi[2] = { box.Right(), box.Bottom() };
+
+    for (int axis = 0; axis < 2; ++axis) {
+        if (d[axis] == 0.0) {
+            if (o[axis] < lo[axis] || o[axis] > hi[axis]) return false;
+            continue;
+        }
+        double inv = 1.0 / d[axis];
+        double t1 = (lo[axis] - o[axis]) * inv;
+        double t2 = (hi[axis] - o[axis]) * inv;
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax) return false;
+    }
+
+    tEntry = tMin;
+    return true;
+}
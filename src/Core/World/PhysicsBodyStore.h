@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Util/GMath.h"
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+
+// Hot physics state for every object in a World, one array per field so the
+// integrator and solvers stream through memory instead of chasing each
+// object's components. While an object is in a world its TransformComponent
+// and PhysicalPropertiesComponent read and write through here.
+class PhysicsBodyStore {
+public:
+    using BodyId = uint32_t;
+    static constexpr BodyId NullBody = UINT32_MAX;
+
+    enum Flags : uint8_t {
+        Anchored = 1 << 0,
+        Sleeping = 1 << 1  // at rest; skipped by integration and movement until woken
+    };
+
+    // Appends a body for obj and binds its components to it
+    BodyId Add(GameObject* obj);
+    // Unbinds the body's components (they keep its last state) and moves the
+    // last body into the freed slot
+    void Remove(BodyId id);
+    void Clear();
+
+    size_t Size() const { return owners.size(); }
+    GameObject* GetObject(BodyId id) const { return owners[id]; }
+
+    Vector2d GetPosition(BodyId id) const { return { x[id], y[id] }; }
+    void SetPosition(BodyId id, const Vector2d& pos) { x[id] = pos.x; y[id] = pos.y; ResetBounds(id); }
+    void Translate(BodyId id, const Vector2d& delta) { x[id] += delta.x; y[id] += delta.y; RefreshBounds(id); }
+
+    // World-space bounds of the body's hitboxes, kept in step with its position.
+    // Swept bounds cover the path given to the last Sweep call; moving along it
+    // keeps them, while SetPosition or new local bounds collapse them to the bounds.
+    const Rect2d& GetBounds(BodyId id) const { return bounds[id]; }
+    const Rect2d& GetSweptBounds(BodyId id) const { return sweptBounds[id]; }
+    const std::vector<Rect2d>& GetAllBounds() const { return bounds; }
+    // Union of the owner's hitbox bounds, relative to its position
+    void SetLocalBounds(BodyId id, const Rect2d& local) { localBounds[id] = local; ResetBounds(id); }
+    void Sweep(BodyId id, const Vector2d& displacement) {
+        sweptBounds[id] = displacement.LengthSquared() == 0
+            ? bounds[id] : bounds[id].Union(bounds[id].Translated(displacement));
+    }
+
+    // Where the body was when the last tick started, blended towards where it is now
+    Vector2d GetInterpolatedPosition(BodyId id, double alpha) const {
+        return { px[id] + (x[id] - px[id]) * alpha, py[id] + (y[id] - py[id]) * alpha };
+    }
+    void SavePreviousPositions() { px = x; py = y; }
+
+    Vector2d GetVelocity(BodyId id) const { return { vx[id], vy[id] }; }
+    void SetVelocity(BodyId id, const Vector2d& vel) { vx[id] = vel.x; vy[id] = vel.y; }
+
+    Vector2d GetAcceleration(BodyId id) const { return { ax[id], ay[id] }; }
+    void SetAcceleration(BodyId id, const Vector2d& acc) { ax[id] = acc.x; ay[id] = acc.y; }
+
+    // Zero for anchored bodies
+    float GetInverseMass(BodyId id) const { return invMass[id]; }
+    bool IsAnchored(BodyId id) const { return flags[id] & Anchored; }
+    void SetMassProperties(BodyId id, float mass, bool anchored);
+
+    bool IsSleeping(BodyId id) const { return flags[id] & Sleeping; }
+    // Anchored or asleep: the body will not move on its own this tick
+    bool IsResting(BodyId id) const { return flags[id] & (Anchored | Sleeping); }
+    void Wake(BodyId id) { flags[id] &= ~Sleeping; restTicks[id] = 0; }
+
+    // Puts bodies to sleep once their speed and acceleration have stayed within
+    // the limits for `ticks` consecutive calls; refreshes the counts below.
+    // ticks == 0 wakes everything.
+    void UpdateSleep(double maxVelocity, double maxAcceleration, uint32_t ticks);
+    size_t GetSleepingCount() const { return sleepingCount; }
+    size_t GetAwakeCount() const { return awakeCount; }
+
+    // v += a * dt for every body that is neither anchored nor asleep
+    void Integrate(double dt);
+
+    // x += v * step for every body that is neither anchored nor asleep; calls
+    // onMoved(id) for each one that actually changed position
+    template <typename Fn>
+    void Advance(double step, Fn&& onMoved);
+
+private:
+    void RefreshBounds(BodyId id) { bounds[id] = localBounds[id].Translated({ x[id], y[id] }); }
+    void ResetBounds(BodyId id) { RefreshBounds(id); sweptBounds[id] = bounds[id]; }
+
+    std::vector<double> x, y;
+    std::vector<double> px, py; // positions at the start of the last tick, for render interpolation
+    std::vector<double> vx, vy;
+    std::vector<double> ax, ay;
+    std::vector<float> invMass;
+    std::vector<uint8_t> flags;
+    std::vector<uint32_t> restTicks; // consecutive ticks spent under the sleep limits
+    std::vector<Rect2d> localBounds, bounds, sweptBounds;
+    std::vector<GameObject*> owners;
+
+    size_t sleepingCount = 0;
+    size_t awakeCount = 0;
+};
+
+template <typename Fn>
+void PhysicsBodyStore::Advance(double step, Fn&& onMoved) {
+    for (BodyId i = 0; i < owners.size(); ++i) {
+        if (flags[i] & (Anchored | Sleeping)) continue;
+
+        double dx = vx[i] * step, dy = vy[i] * step;
+        x[i] += dx;
+        y[i] += dy;
+        if (dx * dx + dy * dy == 0) continue;
+
+        RefreshBounds(i);
+        onMoved(i);
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+enum class BroadphaseType : uint8_t {
+    SpatialHash, // uniform grid, best when bodies are similarly sized
+    AABBTree     // dynamic BVH, best for mixed sizes (long walls + small projectiles)
+};
+
+enum class SolverMode : uint8_t {
+    // Advance the whole world to the earliest contact, resolve it, rescan everything
+    Global,
+    // Split bodies into islands that can touch this tick and step each one
+    // separately, so independent contacts do not restart each other
+    Islands
+};
+
+// Tunables for the World collision pipeline.
+struct PhysicsSettings {
+    BroadphaseType broadphase = BroadphaseType::SpatialHash;
+    SolverMode solver = SolverMode::Global;
+
+    // Edge length of a broadphase grid cell, in world units. Pick something a
+    // bit larger than a typical moving object so most bodies span 1-4 cells.
+    double broadphaseCellSize = 64.0;
+
+    // How far AABB tree leaves are fattened beyond the tight bounds, in world units.
+    // Larger margins mean fewer re-inserts but more candidate pairs to reject.
+    double aabbTreeMargin = 4.0;
+
+    // Extra threads that sweep candidate pairs alongside the tick thread.
+    // 0 keeps the narrowphase on the tick thread. Results do not depend on this.
+    unsigned narrowphaseThreads = 0;
+
+    // Below this many pairs a pass is swept on the tick thread alone, since
+    // waking the workers would cost more than it saves.
+    size_t parallelPairThreshold = 512;
+
+    // Bodies whose speed and acceleration stay within these limits for
+    // sleepTicks consecutive ticks fall asleep: they are skipped by integration
+    // and broadphase refits until touched, moved or woken. 0 disables sleeping.
+    double sleepVelocity = 0.01;     // world units / s
+    double sleepAcceleration = 0.01; // world units / s^2
+    uint32_t sleepTicks = 32;
+
+    // Contacts resolved on one tick are cached. While their hitboxes stay within
+    // contactSlop of each other, the next tick starts from the impulse they
+    // needed and refines it over contactIterations passes, so resting piles and
+    // pushing crowds are settled up front instead of re-colliding every tick.
+    bool warmStarting = true;
+    double contactSlop = 0.01;       // world units
+    uint32_t contactIterations = 4;
+    uint32_t contactExpiryTicks = 8; // cached contacts untouched for longer are dropped
+};
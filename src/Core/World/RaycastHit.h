@@ -4,7 +4,22 @@
 #include "Util/GMath.h"
 
 struct RaycastHit {
-    GameObject* object;
+    GameObject* object = nullptr; // null when nothing was hit
     Vector2d point;
-    double distance;
+    double distance = 0.0;
+    Vector2d normal; // surface normal at the hit, facing back along the query
+};
+
+struct Ray {
+    Vector2d origin;
+    Vector2d direction; // need not be normalized
+    double maxDistance;
+};
+
+// Narrows down which hitboxes a World query may report
+struct QueryFilter {
+    // Only hitboxes this group collides with (per the CollisionMatrix) are reported
+    CollisionGroup group = CollisionGroup::DefaultCollidable;
+    const GameObject* ignore = nullptr;
+    bool includeTriggers = false;
 };
@@ -20,20 +20,20 @@ public:
 
     void QueueReplication(GameObject* obj) {
         if (!isServer) return;
-        if (std::find(replicationQueue.begin(), replicationQueue.end(), obj) == replicationQueue.end())
-            replicationQueue.push_back(obj);
+        ObjectHandle handle = obj->GetHandle();
+        if (std::find(replicationQueue.begin(), replicationQueue.end(), handle) == replicationQueue.end())
+            replicationQueue.push_back(handle);
     }
 
     void Tick(float dt) override {
         World::Tick(dt);
     }
 
-    void ProcessReplicationQueue(NetworkSystem& network) {
-        if (!isServer) return;
-
-        ReplicationPacket packet;
-
-        for (GameObject* obj : replicationQueue) {
+    // Adds the queued objects still dirty and in this world to packet, and clears
+    // them and the queue
+    void CollectReplication(ReplicationPacket& packet) {
+        for (ObjectHandle handle : replicationQueue) {
+            GameObject* obj = Resolve(handle);
             if (!obj || !obj->IsDirty())
                 continue;
 
@@ -41,10 +41,20 @@ public:
             obj->ClearDirty();
         }
 
-        network.broadcast(packet);
-
         replicationQueue.clear();
     }
 
+    void ProcessReplicationQueue(NetworkSystem& network) {
+        if (!isServer) return;
+
+        ReplicationPacket packet;
+        CollectReplication(packet);
+
+        if (JobSystem* jobs = GetJobSystem())
+            packet.EncodeObjects(*jobs);
+
+        network.broadcast(packet);
+    }
+
     ~ServerWorld() override = default;
 };
\ No newline at end of file
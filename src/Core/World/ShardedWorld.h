@@ -0,0 +1,157 @@
+#pragma once
+
+#include "World.h"
+#include "PhysicsSettings.h"
+#include "Util/GMath.h"
+#include "Core/JobSystem.h"
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class NetworkSystem;
+class ReplicationPacket;
+class ServerWorld;
+
+// Layout of a ShardedWorld. Regions are square cells of a columns x rows grid;
+// the outermost cells extend to infinity, so every position has an owner.
+struct ShardSettings {
+    Vector2d origin;             // top-left corner of region (0, 0)
+    double regionSize = 1024.0;  // side of each region, in world units
+    uint32_t columns = 2;
+    uint32_t rows = 2;
+
+    // Objects whose bounds come within this distance of a neighbouring region are
+    // mirrored into it as ghosts. Keep it above the distance a body travels per tick.
+    double haloWidth = 64.0;
+
+    // Workers started alongside the tick thread when no shared job system is set.
+    // Results do not depend on this.
+    unsigned threads = 0;
+
+    PhysicsSettings physics;     // applied to every region
+};
+
+// A world split into spatial regions, each simulated by its own World::Tick as a
+// job. Every object is owned by the region containing the centre of its
+// bounds. Between ticks:
+//   - objects that left their region migrate to the new owner;
+//   - objects near a border get a ghost in each region they reach: a copy of their
+//     hitboxes, mass and motion that local bodies collide against. Ghosts are
+//     overwritten from their source every tick, so whatever happens to a ghost
+//     during a tick is discarded and only the owner's simulation counts.
+// Regions never touch each other's state while ticking, so object callbacks
+// (Ticked, Moved, Collided...) run on worker threads but only ever see their
+// own region. The exception is collisions with ghosts: those are gathered while
+// regions tick and fired afterwards on the calling thread, between the real
+// objects, once per pair.
+// On a server the regions are ServerWorlds: objects marked dirty queue in their
+// region's replication queue, and ProcessReplicationQueue sends all of them as
+// one packet.
+class ShardedWorld {
+public:
+    explicit ShardedWorld(bool isServer, const ShardSettings& settings = {});
+    ~ShardedWorld();
+
+    ShardedWorld(const ShardedWorld&) = delete;
+    ShardedWorld& operator=(const ShardedWorld&) = delete;
+
+    void Tick(float dt);
+
+    // Ticks regions (and their narrowphase) on a shared job system instead of
+    // the settings' own workers; nullptr goes back to those
+    void SetJobSystem(JobSystem* jobs);
+
+    template <typename T, typename... Args>
+    T& SpawnObject(const Vector2d& position, Args&&... args) {
+        static_assert(std::is_base_of_v<GameObject, T>, "T must derive from GameObject");
+
+        auto obj = std::make_unique<T>(std::forward<Args>(args)...);
+        T& ref = *obj;
+        ref.SetPosition(position);
+        AddObject(std::move(obj));
+        return ref;
+    }
+
+    // Hands obj to the region owning it. Hitboxes added afterwards may move that
+    // owner; the object migrates on the next tick.
+    GameObject& AddObject(std::unique_ptr<GameObject> obj);
+    void RemoveObject(const GameObject* obj);
+
+    // Server only: the dirty objects queued by every region, as one packet.
+    // Call between ticks.
+    void CollectReplication(ReplicationPacket& packet);
+    void ProcessReplicationQueue(NetworkSystem& network);
+
+    // Region owning a point / an object
+    size_t GetRegionIndex(const Vector2d& point) const;
+    size_t GetOwnerRegion(const GameObject& obj) const;
+
+    size_t GetRegionCount() const { return regions.size(); }
+    World& GetRegion(size_t index) { return *regions[index].world; }
+    const World& GetRegion(size_t index) const { return *regions[index].world; }
+
+    bool IsGhost(const GameObject* obj) const;
+    // Objects owned by regions, ghosts excluded
+    size_t GetObjectCount() const;
+    size_t GetGhostCount() const;
+    // Objects that changed region at the start of the last tick
+    size_t GetMigrationCount() const { return migrations; }
+
+    // Calls fn(GameObject&) for every owned object, region by region
+    template <typename Fn>
+    void ForEachObject(Fn&& fn) const {
+        for (const auto& region : regions)
+            for (const auto& obj : region.world->GetObjects())
+                if (!region.ghostObjects.count(obj.get())) fn(*obj);
+    }
+
+    const ShardSettings& GetSettings() const { return settings; }
+
+private:
+    class GhostObject;
+
+    struct Ghost {
+        GhostObject* object;
+        uint64_t stamp; // last refresh that still needed it
+    };
+
+    struct Region {
+        std::unique_ptr<World> world;
+        ServerWorld* server = nullptr;                         // world, on a server
+        std::unordered_map<UUID, Ghost> ghosts;                // keyed by the source object
+        std::unordered_set<const GameObject*> ghostObjects;
+        // (ghost, other) pairs that collided during the last tick, written by the region's job only
+        std::vector<std::pair<GhostObject*, GameObject*>> ghostCollisions;
+    };
+
+    struct PairHash {
+        size_t operator()(const std::pair<const GameObject*, const GameObject*>& p) const noexcept {
+            size_t h = std::hash<const void*>()(p.first);
+            return h ^ (std::hash<const void*>()(p.second) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+        }
+    };
+
+    ShardSettings settings;
+    std::vector<Region> regions;
+    std::unique_ptr<JobSystem> ownedJobs;
+    JobSystem* jobs; // ownedJobs or a shared system
+
+    uint64_t refreshStamp = 0;
+    size_t migrations = 0;
+
+    // Scratch, reused between ticks
+    std::vector<std::pair<GameObject*, size_t>> leaving; // (object, new owner)
+    std::vector<GameObject*> staleGhosts;
+    std::vector<std::pair<GameObject*, GameObject*>> forwarded; // real pairs that collided through ghosts
+    std::unordered_set<std::pair<const GameObject*, const GameObject*>, PairHash> forwardedKeys;
+
+    // Column / row of a coordinate, clamped onto the grid
+    int CellX(double x) const;
+    int CellY(double y) const;
+
+    void MigrateObjects();
+    void RefreshGhosts();
+    void UpdateGhost(Region& region, size_t owner, GameObject& source);
+    void ForwardGhostCollisions();
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "IBroadphase.h"
+#include "Core/SlabAllocator.h"
+#include <unordered_map>
+
+// Uniform-grid broadphase. Every proxy is bucketed into each cell its AABB
+// touches; cells are hashed so the world has no fixed extents.
+class SpatialHashGrid : public IBroadphase {
+public:
+    explicit SpatialHashGrid(double cellSize = 64.0);
+
+    ProxyId CreateProxy(const Rect2d& aabb, GameObject* object) override;
+    void DestroyProxy(ProxyId id) override;
+
+    // Updates the proxy's AABB, only touching buckets when its cell range changed
+    void MoveProxy(ProxyId id, const Rect2d& aabb) override;
+
+    const Rect2d& GetAABB(ProxyId id) const override { return proxies[id].aabb; }
+    GameObject* GetObject(ProxyId id) const override { return proxies[id].object; }
+
+    void SetCellSize(double size);
+    double GetCellSize() const { return cellSize; }
+
+    void QueryPairs(std::vector<ProxyPair>& out) override;
+    void QueryRegion(const Rect2d& region, std::vector<ProxyId>& out) const override;
+    void QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                  std::vector<ProxyId>& out) const override;
+
+    // Calls fn(ProxyId) once for every proxy whose AABB overlaps the region.
+    template <typename Fn>
+    void Query(const Rect2d& region, Fn&& fn) const;
+
+    void Clear() override;
+
+private:
+    struct CellRange {
+        int32_t minX = 0, minY = 0, maxX = -1, maxY = -1;
+        bool operator==(const CellRange&) const = default;
+    };
+
+    struct Proxy {
+        Rect2d aabb;
+        GameObject* object = nullptr;
+        CellRange cells;
+        bool alive = false;
+    };
+
+    double cellSize;
+    double invCellSize;
+
+    std::vector<Proxy> proxies;
+    std::vector<ProxyId> freeList;
+    // Cells are created and dropped as objects move, so both the map nodes and
+    // the buckets come from the pools instead of the heap
+    using Bucket = std::vector<ProxyId, SlabStlAllocator<ProxyId>>;
+    std::unordered_map<uint64_t, Bucket, std::hash<uint64_t>, std::equal_to<uint64_t>,
+                       SlabStlAllocator<std::pair<const uint64_t, Bucket>>> cells;
+    // Every cell that has held a proxy since the last Clear lies within this
+    // range. It only grows, but it bounds ray walks, including infinite rays.
+    CellRange occupied;
+
+    static uint64_t CellKey(int32_t x, int32_t y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    CellRange ComputeRange(const Rect2d& aabb) const;
+    void Insert(ProxyId id, const CellRange& range);
+    void Remove(ProxyId id, const CellRange& range);
+};
+
+template <typename Fn>
+void SpatialHashGrid::Query(const Rect2d& region, Fn&& fn) const {
+    CellRange range = ComputeRange(region);
+    for (int32_t cx = range.minX; cx <= range.maxX; ++cx) {
+        for (int32_t cy = range.minY; cy <= range.maxY; ++cy) {
+            auto it = cells.find(CellKey(cx, cy));
+            if (it == cells.end()) continue;
+
+            for (ProxyId id : it->second) {
+                const Proxy& p = proxies[id];
+                // Report each proxy only from the first cell it shares with the region
+                if (cx != std::max(range.minX, p.cells.minX) || cy != std::max(range.minY, p.cells.minY))
+                    continue;
+                if (p.aabb.Intersects(region))
+                    fn(id);
+            }
+        }
+    }
+}
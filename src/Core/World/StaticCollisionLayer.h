@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Util/GMath.h"
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+
+// Immutable bounding volume hierarchy over anchored geometry. Built once from
+// a snapshot of the anchored objects and only rebuilt when one of them
+// changes. Nodes are stored depth-first in one array (left child follows its
+// parent) and leaf items are packed contiguously, so queries walk linear memory.
+class StaticCollisionLayer {
+public:
+    struct Entry {
+        Rect2d aabb;
+        GameObject* object;
+    };
+
+    // Replaces the layer's contents; entries is reordered in the process
+    void Build(std::vector<Entry>& entries);
+    void Clear();
+
+    size_t Size() const { return items.size(); }
+    GameObject* GetObject(uint32_t item) const { return items[item].object; }
+    const Rect2d& GetAABB(uint32_t item) const { return items[item].aabb; }
+
+    // Calls fn(itemIndex) for every item whose AABB overlaps the region.
+    template <typename Fn>
+    void Query(const Rect2d& region, Fn&& fn) const;
+
+    void QueryRegion(const Rect2d& region, std::vector<uint32_t>& out) const;
+
+    // Items whose AABB is crossed by origin + dir * t, t in [0, maxDistance]
+    void QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                  std::vector<uint32_t>& out) const;
+
+private:
+    static constexpr uint32_t LeafSize = 4;
+
+    struct Node {
+        Rect2d bounds;
+        uint32_t offset; // leaf: first item, internal: right child (left child is the next node)
+        uint32_t count;  // leaf: item count, internal: 0
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Entry> items;
+
+    uint32_t BuildRange(uint32_t first, uint32_t count);
+
+    template <typename Descend, typename Visit>
+    void Traverse(Descend&& descend, Visit&& visit) const;
+};
+
+template <typename Descend, typename Visit>
+void StaticCollisionLayer::Traverse(Descend&& descend, Visit&& visit) const {
+    if (nodes.empty()) return;
+
+    // Median splits keep the depth at log2(n), far below the stack size
+    uint32_t stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const uint32_t index = stack[--top];
+        const Node& n = nodes[index];
+        if (!descend(n.bounds)) continue;
+
+        if (n.count > 0) {
+            for (uint32_t i = n.offset; i < n.offset + n.count; ++i)
+                visit(i);
+            continue;
+        }
+
+        stack[top++] = n.offset;
+        stack[top++] = index + 1;
+    }
+}
+
+template <typename Fn>
+void StaticCollisionLayer::Query(const Rect2d& region, Fn&& fn) const {
+    Traverse(
+        [&region](const Rect2d& box) { return box.Intersects(region); },
+        [&](uint32_t item) {
+            if (items[item].aabb.Intersects(region))
+                fn(item);
+        });
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class GameObject;
+
+// How often a world calls an object's Tick. Physics integrates every body on
+// every tick regardless; tiers only thin out game logic.
+enum class TickTier : uint8_t {
+    EveryTick,
+    Every2nd,
+    Every8th,
+    Dormant, // never ticked until moved to another tier
+    Count
+};
+
+// Distance-based tier assignment. Every reassignTicks ticks, each object the
+// world decides for is put in the tier for its distance to the nearest player
+// entity: EveryTick below every2ndDistance, then Every2nd, Every8th, and Dormant
+// from dormantDistance on. Objects whose tier was set by hand keep it.
+struct TickLodSettings {
+    bool enabled = false;
+    double every2ndDistance = 512.0;  // world units
+    double every8thDistance = 1536.0;
+    double dormantDistance = 4096.0;
+    uint32_t reassignTicks = 8;
+};
+
+// Objects bucketed by tick tier. A tier ticking every Nth tick is split into N
+// phase buckets, and a tick walks only the buckets that are due, so objects
+// that are not due are never touched. Each object is ticked with the time
+// accumulated since it last ticked (or joined), so dt-driven logic keeps time
+// whatever its tier.
+class TickScheduler {
+public:
+    static constexpr uint8_t NoBucket = 0xff;
+
+    // slot: the object's handle index in its world, stable while it is in it
+    void Add(GameObject* obj, uint32_t slot, double now);
+    void Remove(uint32_t slot);
+
+    // pinned tiers are left alone by automatic assignment
+    void SetTier(uint32_t slot, TickTier tier, bool pinned);
+    TickTier GetTier(uint32_t slot) const;
+    bool IsPinned(uint32_t slot) const { return slot < locations.size() && locations[slot].pinned; }
+
+    // Calls fn(object, dt) for every object due on tick number `tick` ending at
+    // time `now`. fn may add, remove and re-tier objects: objects added meanwhile
+    // first tick on a later call, and none is ticked twice, but removing an object
+    // other than the one being ticked may make another one miss this call.
+    template <typename Fn>
+    void ForEachDue(uint64_t tick, double now, Fn&& fn);
+
+    size_t GetCount(TickTier tier) const;
+    // Objects ticked by the last ForEachDue call
+    size_t GetTickedCount() const { return ticked; }
+
+private:
+    struct Entry {
+        GameObject* object;
+        uint32_t slot;
+        double lastTick; // time the object last ticked
+        uint64_t stamp;  // `current` when last ticked or added
+    };
+
+    struct Location {
+        uint8_t bucket = NoBucket;
+        bool pinned = false;
+        uint32_t index = 0;
+    };
+
+    static constexpr std::array<uint32_t, size_t(TickTier::Count)> Intervals = { 1, 2, 8, 1 };
+    static constexpr std::array<uint8_t, size_t(TickTier::Count)> FirstBucket = { 0, 1, 3, 11 };
+    static constexpr size_t BucketCount = 12;
+
+    static TickTier TierOf(uint8_t bucket);
+    // Objects are spread over a tier's phases by slot, so each phase gets a share
+    static uint8_t BucketFor(TickTier tier, uint32_t slot) {
+        return uint8_t(FirstBucket[size_t(tier)] + slot % Intervals[size_t(tier)]);
+    }
+
+    void Insert(const Entry& entry, uint8_t bucket);
+    Entry Erase(uint32_t slot);
+
+    std::array<std::vector<Entry>, BucketCount> buckets;
+    std::vector<Location> locations; // by handle slot
+    uint64_t current = 0; // stamp of the ForEachDue call running or last run
+    size_t ticked = 0;
+};
+
+template <typename Fn>
+void TickScheduler::ForEachDue(uint64_t tick, double now, Fn&& fn) {
+    current = tick + 1;
+    ticked = 0;
+    for (size_t t = 0; t < size_t(TickTier::Dormant); ++t) {
+        std::vector<Entry>& bucket = buckets[FirstBucket[t] + tick % Intervals[t]];
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            Entry& entry = bucket[i];
+            if (entry.stamp == current) continue; // added or already ticked during this call
+            GameObject* obj = entry.object;
+            float dt = float(now - entry.lastTick);
+            entry.lastTick = now;
+            entry.stamp = current;
+            ++ticked;
+            fn(obj, dt);
+            // The object left the bucket and another took its place; look at that one next
+            if (i < bucket.size() && bucket[i].object != obj) --i;
+        }
+    }
+}
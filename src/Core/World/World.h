@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CollisionMatrix.h"
+#include "Contact.h"
+#include "ContactCache.h"
 #include "Core/Objects/CollisionGroups.h"
 #include "Core/Objects/PlayerEntity.h"
 #include "RaycastHit.h"
@@ -8,20 +10,168 @@
 #include "Core/Objects/Entity.h"
 #include "Core/Player/Player.h"
 #include <optional>
+#include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 #include "IWorld.h"
+#include "IBroadphase.h"
+#include "PhysicsSettings.h"
+#include "StaticCollisionLayer.h"
+#include "PhysicsBodyStore.h"
+#include "Core/JobSystem.h"
+#include "Core/Components/HealthComponent.h"
+#include "WorldEventBuffer.h"
+#include "TickScheduler.h"
 
 class World : public IWorld {
 protected:
+    // Component state swept by the world's systems, one packed store per
+    // component set: bodies hold (Transform, PhysicalProperties), which
+    // Integrate and Advance move; healthStore holds (Health), which TickSystems
+    // regenerates. Declared before objects so they outlive them.
+    PhysicsBodyStore bodies;
+    HealthComponent::Store healthStore;
+
     std::vector<std::unique_ptr<GameObject>> objects;
     std::vector<GameObject*> destroyQueue;
-    std::vector<GameObject*> replicationQueue;
+
+    // Handle slots point into objects; removal moves the last object into the
+    // freed position and repoints its slot, so nothing is ever shifted
+    struct HandleSlot {
+        uint32_t object = ObjectHandle::NullIndex; // index into objects; null while free
+        uint32_t generation = 0;
+    };
+    std::vector<HandleSlot> handleSlots;
+    std::vector<uint32_t> freeHandles;
+    std::unordered_map<UUID, uint32_t, std::hash<UUID>, std::equal_to<UUID>,
+                       SlabStlAllocator<std::pair<const UUID, uint32_t>>> uuidIndex; // to a handle slot
+    // Objects by tag, in no particular order. positions[slot] is where the object
+    // with that handle slot sits in objects, while it has the tag.
+    struct TagBucket {
+        std::vector<GameObject*> objects;
+        std::vector<uint32_t> positions;
+    };
+    std::vector<TagBucket> tagIndex; // by TagId
+    std::vector<ObjectHandle> replicationQueue; // resolved when processed, so removed objects drop out
     std::vector<std::unique_ptr<LogicalPlayer>> players;
 
     bool isServer;
 
+    PhysicsSettings physicsSettings;
+    std::unique_ptr<IBroadphase> broadphase;
+    std::vector<IBroadphase::ProxyPair> proxyPairs;
+    std::vector<std::pair<GameObject*, GameObject*>> candidatePairs;
+
+    // Anchored objects are kept out of the broadphase and packed into here instead
+    StaticCollisionLayer staticLayer;
+    std::vector<StaticCollisionLayer::Entry> staticEntries;
+    bool staticGeometryDirty = false;
+
+    // Island solver scratch, reused between ticks
+    std::vector<IBroadphase::ProxyId> islandParent;
+    std::vector<std::pair<IBroadphase::ProxyId, uint32_t>> islandPairs; // (island root, candidate pair index)
+    std::vector<IBroadphase::ProxyId> islandBodies;
+    std::vector<bool> inIsland;
+
+    // Narrowphase result per candidate pair. Each slot is written by exactly one
+    // worker, and slots are reduced in candidate order so the chosen contact
+    // matches a serial sweep regardless of the thread count.
+    struct PairSweep {
+        bool hit = false;
+        Contact contact;
+    };
+    std::vector<PairSweep> pairSweeps;
+    std::unique_ptr<JobSystem> ownedJobs; // started for narrowphaseThreads when no shared system is set
+    JobSystem* sharedJobs = nullptr;
+
+    ContactCache contactCache;
+    WorldEventBuffer events;
+
+    // Held shared by scene queries, and exclusively while the world changes what
+    // they read: its own tick phases and adding or removing objects
+    mutable std::shared_mutex queryMutex;
+
+    // Which objects' Tick runs on which tick
+    TickScheduler scheduler;
+    TickLodSettings tickLod;
+    uint64_t tickCount = 0;  // ticks run so far
+    double tickTime = 0.0;   // sum of their dts
+    std::vector<Vector2d> lodCenters; // player entity positions, reused between assignments
+    size_t narrowphasePasses = 0; // on the current/last tick
+
+    // SlabAllocator traffic during the last Tick call
+    uint64_t tickAllocations = 0;
+    uint64_t tickSystemAllocations = 0;
+
+    // Cached contact still touching at the start of a tick, being warm-started
+    struct WarmContact {
+        uint32_t entry; // index into contactCache
+        GameObject* objectA;
+        GameObject* objectB;
+        PhysicsBodyStore::BodyId a, b;
+        Vector2d normal;
+        double invMassSum;
+        double impulse; // accumulated this tick
+    };
+    std::vector<WarmContact> warmContacts;
+
+    static std::unique_ptr<IBroadphase> CreateBroadphase(const PhysicsSettings& settings);
+
+    // Takes objects[index] out by swapping the last object into its place, and
+    // frees its handle and UUID entry
+    std::unique_ptr<GameObject> DetachObject(uint32_t index);
+
+    // Moves obj's system-driven components into the stores, or back out
+    void BindSystemComponents(GameObject* obj);
+    void UnbindSystemComponents(GameObject* obj);
+    // Systems over the component stores other than the body store, run before object ticks
+    void TickSystems(float dt);
+    void IndexTag(GameObject* obj, TagId tag);
+    void UnindexTag(GameObject* obj, TagId tag);
+    // Puts every unpinned object in the tick tier for its distance to the nearest player entity
+    void AssignTickTiers();
+
+    bool IsDynamic(const GameObject* obj) const { return !bodies.IsAnchored(obj->GetPhysicsBody()); }
+    bool IsSleeping(const GameObject* obj) const { return bodies.IsSleeping(obj->GetPhysicsBody()); }
+    // Moves a body along its velocity for `step` seconds, recording Moved if it went anywhere
+    void AdvanceBody(PhysicsBodyStore::BodyId id, double step);
+    // AdvanceBody for every dynamic body
+    void AdvanceBodies(double step);
+
+    // Refits every object's broadphase proxy to the AABB it sweeps over the next `horizon` seconds
+    void UpdateBroadphase(double horizon);
+    void RemoveFromBroadphase(GameObject* obj);
+    void GatherCandidatePairs(double horizon);
+
+    // Calls fn(object) for every object whose broadphase or static bounds overlap the region
+    template <typename Fn>
+    void ForEachQueryCandidate(const Rect2d& region, Fn&& fn) const;
+    void RebuildStaticLayer();
+
+    // Narrowphase for one object pair over `interval` seconds. Only overwrites
+    // `contact` (and lowers `earliest`) for an impact strictly before `earliest`.
+    bool SweepPair(GameObject* a, GameObject* b, double interval, double& earliest, Contact& contact) const;
+    // Raycast without taking queryMutex
+    bool CastRay(const Vector2d& origin, const Vector2d& direction, double maxDistance,
+                 RaycastHit& hit, const QueryFilter& filter) const;
+    void ApplyContact(const Contact& contact, double step);
+    // Starts cached contacts that are still touching from last tick's impulse and
+    // iterates them, so persistent contacts are settled before the solver sweeps
+    void WarmStartContacts();
+    // Records every object touching a trigger hitbox, within contactSlop, as the tick ends
+    void UpdateTriggerContacts();
+
+    // Sweeps candidatePairs[pairIndex(i)] for i in [begin, end) into pairSweeps,
+    // on the narrowphase pool when there are enough pairs to be worth it
+    template <typename PairIndex>
+    void SweepPairs(size_t begin, size_t end, double interval, PairIndex pairIndex);
+
+    void SolveGlobal(double dt);
+    void SolveIslands(double dt);
+    void SolveIsland(size_t begin, size_t end, double dt);
+
 public:
-    World(bool isServer): isServer(isServer) {};
+    World(bool isServer): isServer(isServer), broadphase(CreateBroadphase(physicsSettings)) {};
 
     bool IsServer() override { return isServer; }
 
@@ -33,14 +183,7 @@ public:
 
         auto obj = std::make_unique<T>(std::forward<Args>(args)...);
         T& ref = *obj;
-        ref.SetWorld(this);
-
-        // When destroyed, mark for removal
-        ref.Destroyed.Connect([this, &ref]() {
-            destroyQueue.push_back(&ref);
-        });
-
-        objects.push_back(std::move(obj));
+        AddObject(std::move(obj));
         return ref;
     }
 
@@ -64,6 +207,9 @@ public:
     void ProcessDestroyQueue();
 
     void RemoveObject(const GameObject* obj) override;
+    // Takes obj out of the world without destroying it; its components keep their
+    // state. Returns nullptr when obj is not in this world.
+    std::unique_ptr<GameObject> ReleaseObject(const GameObject* obj);
     UUID AddObject(std::unique_ptr<GameObject> obj) override;
 
     void RemoveObject(const UUID& id);
@@ -73,63 +219,125 @@ public:
         std::cout << "[World] SpawnPlayer called.\n";
     }
 
-    const GameObject ResolveObject(UUID id) {
-        if (!Find(id)) throw std::runtime_error("[World] could not find entity with id " + id.to_string());
-        return *Find(id);
+    const GameObject& ResolveObject(UUID id) {
+        GameObject* obj = Find(id);
+        if (!obj) throw std::runtime_error("[World] could not find entity with id " + id.to_string());
+        return *obj;
+    }
+
+    // Lookups by UUID and handle are hash / array accesses. With several objects
+    // sharing a UUID, Find returns the one added first.
+    GameObject* Find(UUID id) const {
+        auto it = uuidIndex.find(id);
+        return it == uuidIndex.end() ? nullptr : objects[handleSlots[it->second].object].get();
+    }
+    // nullptr once the object has left this world
+    GameObject* Resolve(ObjectHandle handle) const {
+        if (handle.index >= handleSlots.size()) return nullptr;
+        const HandleSlot& slot = handleSlots[handle.index];
+        return slot.generation == handle.generation ? objects[slot.object].get() : nullptr;
+    }
+    bool Contains(const GameObject* obj) const { return obj && Resolve(obj->GetHandle()) == obj; }
+
+    // Called by GameObject::Destroy; ProcessDestroyQueue removes the object
+    void QueueDestroy(GameObject* obj) { destroyQueue.push_back(obj); }
+
+    // True while Tick runs up to its event dispatch; objects then record their
+    // events here instead of firing them
+    bool IsRecordingEvents() const { return events.IsRecording(); }
+    void RecordMoved(GameObject* obj) { events.RecordMoved(obj); }
+    void RecordDestroyed(GameObject* obj) { events.RecordDestroyed(obj); }
+    const WorldEventBuffer& GetEvents() const { return events; }
+    // Keeps Find working for an object whose UUID was overwritten, e.g. by Decode
+    void ReindexUuid(const UUID& previous, const UUID& current);
+    // Called by GameObject when one of its tags is added or removed
+    void OnObjectTagChanged(GameObject* obj, TagId tag, bool added);
+    // Called by GameObject when a component is added or replaced
+    void OnObjectComponentSet(GameObject* obj, ComponentTypeId id);
+    const HealthComponent::Store& GetHealthStore() const { return healthStore; }
+
+    // Every object in this world with the tag, in no particular order. The list
+    // changes as tags are added and removed, so copy it before doing either.
+    const std::vector<GameObject*>& GetObjectsWithTag(TagId tag) const;
+    const std::vector<GameObject*>& GetObjectsWithTag(std::string_view tag) const {
+        return GetObjectsWithTag(Tags::Find(tag));
     }
+    // Scene queries. Any number of threads may run them at once, also while
+    // another thread ticks the world: they wait out the tick's physics and
+    // acceleration structure updates, and run between them while objects tick and
+    // listeners fire. They see objects as of the end of the last tick (objects
+    // spawned since then are not in the acceleration structures yet) and append
+    // into caller-owned buffers. Game code changing an object's position, velocity
+    // or hitboxes is not waited for, so do that where no query can overlap it.
+
+    // Nearest hitbox along the ray; false (and hit.object == nullptr) on a miss
+    bool Raycast(const Vector2d& origin, const Vector2d& direction, double maxDistance,
+                 RaycastHit& hit, const QueryFilter& filter = {}) const;
+    // hits[i] receives the result for rays[i]; returns how many rays hit something
+    size_t RaycastBatch(const std::vector<Ray>& rays, std::vector<RaycastHit>& hits,
+                        const QueryFilter& filter = {}) const;
+    // Sweeps `shape` from origin along displacement and reports the first hitbox it touches.
+    // hit.point is where the shape's origin is at impact.
+    bool ShapeCast(const HitboxShape& shape, const Vector2d& origin, const Vector2d& displacement,
+                   RaycastHit& hit, const QueryFilter& filter = {}) const;
+    // Append each object with a hitbox overlapping the area, once; return how many were appended
+    size_t OverlapAABB(const Rect2d& region, std::vector<GameObject*>& out, const QueryFilter& filter = {}) const;
+    size_t OverlapCircle(const Vector2d& center, double radius, std::vector<GameObject*>& out,
+                         const QueryFilter& filter = {}) const;
+
+    // Returns the normal impulse applied; 0 when a and b were not approaching
+    float ResolveCollision(GameObject* a, GameObject* b, const Vector2d& n, float dt);
 
-    GameObject* Find(UUID id) {
-        for (const auto& obj : objects) {
-            if (obj->GetUUID() == id)
-                return obj.get();
-        }
-        return nullptr;
+    // Objects start out ticking every tick. A tier set here sticks until set
+    // again (pinned), or, with pinned = false, until the next automatic assignment.
+    void SetTickTier(const GameObject* obj, TickTier tier, bool pinned = true) {
+        if (Contains(obj)) scheduler.SetTier(obj->GetHandle().index, tier, pinned);
     }
-    /*
-    std::optional<RaycastHit> Raycast(
-        const Vector2d& origin,
-        const Vector2d& direction,
-        double maxDistance,
-        CollisionGroup mask = CollisionGroup::DefaultCollidable
-    ) {
-        Vector2d dir = direction.Normalized();
-        std::optional<RaycastHit> nearestHit;
-        double nearestDist = maxDistance;
-
-        for (auto& objPtr : objects) {
-            GameObject* obj = objPtr.get();
-            if (!obj->HasComponent<TransformComponent>() || !obj->HasComponent<HitboxComponent>())
-                continue;
-
-            auto transform = obj->GetComponent<TransformComponent>();
-            auto hitbox = obj->GetComponent<HitboxComponent>();
-
-            if (hitbox->GetGroup() == CollisionGroup::DefaultNonCollidable)
-                continue;
-
-            if (!CollisionMatrix::ShouldCollide(mask, hitbox->GetGroup()))
-                continue;
-
-            Rect2 worldRect = hitbox->GetLocalBounds().Translated(transform->GetPosition());
-
-            double tNear;
-            if (worldRect.RayIntersectsRect(origin, dir, tNear)) {
-                if (tNear >= 0.0 && tNear < nearestDist) {
-                    nearestDist = tNear;
-                    nearestHit = RaycastHit{
-                        .object = obj,
-                        .point = origin + dir * tNear,
-                        .distance = tNear
-                    };
-                }
-            }
-        }
-
-        return nearestHit;
+    TickTier GetTickTier(const GameObject* obj) const {
+        return Contains(obj) ? scheduler.GetTier(obj->GetHandle().index) : TickTier::EveryTick;
+    }
+    const TickLodSettings& GetTickLodSettings() const { return tickLod; }
+    void SetTickLodSettings(const TickLodSettings& settings);
+    const TickScheduler& GetTickScheduler() const { return scheduler; }
+
+    const PhysicsSettings& GetPhysicsSettings() const { return physicsSettings; }
+    void SetPhysicsSettings(const PhysicsSettings& settings);
+
+    // Runs the parallel parts of the tick on a shared job system instead of the
+    // narrowphaseThreads workers; nullptr goes back to those. Components can also
+    // reach it through GetJobSystem() to submit their own work.
+    void SetJobSystem(JobSystem* jobs);
+    // The job system ticks use, or nullptr when they run on the tick thread alone
+    JobSystem* GetJobSystem() const { return sharedJobs ? sharedJobs : ownedJobs.get(); }
+
+    const IBroadphase& GetBroadphase() const { return *broadphase; }
+    const PhysicsBodyStore& GetBodies() const { return bodies; }
+
+    void WakeBody(PhysicsBodyStore::BodyId id) { bodies.Wake(id); }
+    void SetBodyLocalBounds(PhysicsBodyStore::BodyId id, const Rect2d& local) { bodies.SetLocalBounds(id, local); }
+
+    // Position to draw obj at, `alpha` of the way from the previous tick to the current one
+    Vector2d GetRenderPosition(const GameObject& obj, double alpha) const {
+        PhysicsBodyStore::BodyId id = obj.GetPhysicsBody();
+        if (id == PhysicsBodyStore::NullBody || bodies.GetObject(id) != &obj) return obj.GetPosition();
+        return bodies.GetInterpolatedPosition(id, alpha);
     }
-    */
+    // Non-anchored bodies asleep / awake at the end of the last tick
+    size_t GetSleepingBodyCount() const { return bodies.GetSleepingCount(); }
+    size_t GetAwakeBodyCount() const { return bodies.GetAwakeCount(); }
+    const StaticCollisionLayer& GetStaticLayer() const { return staticLayer; }
+    const ContactCache& GetContactCache() const { return contactCache; }
+    // Narrowphase sweeps over candidate pairs run by the solver on the last tick
+    size_t GetNarrowphasePassCount() const { return narrowphasePasses; }
+    // Pooled blocks (objects, components...) allocated during the last Tick, and
+    // how many of those needed memory from the system. The counts are process
+    // wide, so they include other threads allocating meanwhile. Once pools are
+    // warm, a tick that spawns nothing should need nothing from the system.
+    uint64_t GetTickAllocationCount() const { return tickAllocations; }
+    uint64_t GetTickSystemAllocationCount() const { return tickSystemAllocations; }
 
-    void ResolveCollision(GameObject* a, GameObject* b, const Vector2d& n, float dt);
+    // Called when an anchored object moves, changes shape, or toggles anchoring
+    void MarkStaticGeometryDirty() { staticGeometryDirty = true; }
 
     const std::vector<std::unique_ptr<GameObject>>& GetObjects() const { return objects; }
 
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core/Objects/ObjectHandle.h"
+#include "Core/SlabAllocator.h"
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+class GameObject;
+class World;
+
+// Object events raised while a World ticks, held back until the physics is
+// done and then dispatched in batches, so listeners never run inside the solver
+// and cannot change the world under it. Recording coalesces:
+//   - Moved: once per object, with the position it ends the tick at;
+//   - Collided: once per object pair, to each side (triggers included), or
+//     only to the stand-in when either side is one;
+//   - TriggerEntered / TriggerExited: a pair whose trigger overlap (recorded by
+//     the world at the end of each tick) started or ended this tick;
+//   - Destroyed: once per object, last.
+// Events are dispatched in the order they were first recorded. Objects are held
+// by handle and resolved at dispatch, so events of an object that left the
+// world meanwhile are dropped. Outside a tick (and while dispatching) nothing is
+// recorded and objects fire their signals directly.
+class WorldEventBuffer {
+public:
+    bool IsRecording() const { return recording; }
+    void Begin();
+
+    // Objects must be in the world being ticked
+    void RecordMoved(const GameObject* obj);
+    void RecordCollision(const GameObject* a, const GameObject* b);
+    // a's trigger volume overlaps b at the end of this tick
+    void RecordTriggerContact(const GameObject* a, const GameObject* b);
+    void RecordDestroyed(const GameObject* obj);
+
+    // Stops recording and fires everything recorded since Begin that still
+    // resolves in world
+    void Dispatch(const World& world);
+
+    // Dispatched by the last Dispatch call
+    size_t GetMovedCount() const { return moved.size(); }
+    size_t GetCollisionCount() const { return collisions.size(); }
+    // Trigger pairs currently touching
+    size_t GetTriggerContactCount() const { return triggers.size(); }
+
+private:
+    struct Pair {
+        ObjectHandle a;
+        ObjectHandle b;
+    };
+
+    // Handles in (index, generation) order
+    struct PairKey {
+        ObjectHandle lo;
+        ObjectHandle hi;
+        bool operator==(const PairKey&) const = default;
+    };
+
+    struct PairHash {
+        size_t operator()(const PairKey& k) const noexcept {
+            size_t h = static_cast<size_t>(k.lo.index) << 32 | k.lo.generation;
+            return h ^ ((static_cast<size_t>(k.hi.index) << 32 | k.hi.generation) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+        }
+    };
+
+    using PairSet = std::unordered_set<PairKey, PairHash, std::equal_to<PairKey>, SlabStlAllocator<PairKey>>;
+
+    static PairKey KeyOf(ObjectHandle a, ObjectHandle b) {
+        bool ordered = a.index != b.index ? a.index < b.index : a.generation < b.generation;
+        return ordered ? PairKey{ a, b } : PairKey{ b, a };
+    }
+
+    struct MovedStamp {
+        uint32_t stamp = 0;      // last Begin the slot's object was recorded as moved in
+        uint32_t generation = 0; // of that object, so a reused slot records afresh
+    };
+
+    bool recording = false;
+    uint32_t stamp = 0; // bumped per Begin
+    std::vector<MovedStamp> movedStamps; // by handle index
+
+    std::vector<ObjectHandle> moved;
+    std::vector<Pair> collisions;
+    PairSet collisionKeys;
+    std::vector<Pair> triggers, previousTriggers; // touching this / last tick
+    PairSet triggerKeys, previousTriggerKeys;
+    std::vector<ObjectHandle> destroyed;
+};
@@ -18,6 +18,7 @@ void Component::Tick(float /*dt*/) {}
 void Component::SetEnabled(bool value) {
     if (enabled == value) return;
     enabled = value;
+    OnEnabledChanged();
     if (enabled) Enabled.Fire();
     else Disabled.Fire();
 }
@@ -0,0 +1,65 @@
+#include "Core/World/ContactCache.h"
+#include <utility>
+
+bool ContactCache::Canonicalize(Key& key) {
+    if (std::pair(key.a.index, key.a.generation) <= std::pair(key.b.index, key.b.generation)) return false;
+    std::swap(key.a, key.b);
+    std::swap(key.hitboxA, key.hitboxB);
+    return true;
+}
+
+void ContactCache::Erase(size_t index) {
+    lookup.erase(entries[index].key);
+    if (index + 1 != entries.size()) {
+        entries[index] = entries.back();
+        lookup[entries[index].key] = static_cast<uint32_t>(index);
+    }
+    entries.pop_back();
+}
+
+void ContactCache::BeginTick(uint32_t expiryTicks) {
+    ++tick;
+
+    for (size_t i = 0; i < entries.size();) {
+        Entry& e = entries[i];
+        if (tick - e.lastTick > expiryTicks) {
+            Erase(i);
+            continue;
+        }
+
+        e.warmImpulse = (e.lastTick + 1 == tick) ? e.impulse : 0.0;
+        e.impulse = 0.0;
+        ++i;
+    }
+}
+
+void ContactCache::Record(ObjectHandle a, ObjectHandle b, uint32_t hitboxA, uint32_t hitboxB,
+                          const Vector2d& normal, double impulse) {
+    Key key{ a, b, hitboxA, hitboxB };
+    bool swapped = Canonicalize(key);
+
+    auto [it, inserted] = lookup.try_emplace(key, static_cast<uint32_t>(entries.size()));
+    if (inserted) {
+        Entry& added = entries.emplace_back();
+        added.key = key;
+    }
+
+    Entry& e = entries[it->second];
+    e.normal = swapped ? -normal : normal;
+    e.impulse += impulse;
+    e.lastTick = tick;
+}
+
+void ContactCache::Clear() {
+    entries.clear();
+    lookup.clear();
+}
+
+const ContactCache::Entry* ContactCache::Find(ObjectHandle a, ObjectHandle b,
+                                              uint32_t hitboxA, uint32_t hitboxB) const {
+    Key key{ a, b, hitboxA, hitboxB };
+    Canonicalize(key);
+
+    auto it = lookup.find(key);
+    return it == lookup.end() ? nullptr : &entries[it->second];
+}
@@ -0,0 +1,319 @@
+#include "Core/World/DynamicAABBTree.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    double Perimeter(const Rect2d& r) { return 2.0 * (r.width + r.height); }
+
+    bool Contains(const Rect2d& outer, const Rect2d& inner) {
+        return outer.Left() <= inner.Left() && outer.Top() <= inner.Top() &&
+               inner.Right() <= outer.Right() && inner.Bottom() <= outer.Bottom();
+    }
+}
+
+DynamicAABBTree::DynamicAABBTree(double margin) : margin(margin) {}
+
+int32_t DynamicAABBTree::AllocateNode() {
+    if (freeList == NullNode) {
+        nodes.emplace_back();
+        nodes.back().height = 0;
+        return static_cast<int32_t>(nodes.size() - 1);
+    }
+
+    int32_t id = freeList;
+    freeList = nodes[id].parent;
+    nodes[id] = Node{};
+    nodes[id].height = 0;
+    return id;
+}
+
+void DynamicAABBTree::FreeNode(int32_t id) {
+    nodes[id] = Node{};
+    nodes[id].parent = freeList;
+    freeList = id;
+}
+
+IBroadphase::ProxyId DynamicAABBTree::CreateProxy(const Rect2d& aabb, GameObject* object) {
+    int32_t leaf = AllocateNode();
+    nodes[leaf].tight = aabb;
+    nodes[leaf].aabb = aabb.Expanded(margin);
+    nodes[leaf].object = object;
+    InsertLeaf(leaf);
+    MarkMoved(leaf);
+    return leaf;
+}
+
+void DynamicAABBTree::DestroyProxy(ProxyId id) {
+    if (id < 0 || id >= static_cast<ProxyId>(nodes.size()) || nodes[id].height != 0) return;
+
+    RemoveLeaf(id);
+    FreeNode(id);
+    // Drops its pairs, even if the id comes back as another proxy first
+    MarkMoved(id);
+}
+
+void DynamicAABBTree::MoveProxy(ProxyId id, const Rect2d& aabb) {
+    Node& leaf = nodes[id];
+    Vector2d displacement(aabb.x - leaf.tight.x, aabb.y - leaf.tight.y);
+    leaf.tight = aabb;
+    if (Contains(leaf.aabb, aabb)) return;
+
+    // Like Box2D, stretch the new fat bounds ahead along the last movement, so a
+    // steadily moving proxy stays inside them for several more moves
+    Rect2d fat = aabb.Expanded(margin);
+    Vector2d ahead = displacement * AabbMultiplier;
+    if (ahead.x < 0.0) fat.x += ahead.x;
+    fat.width += std::abs(ahead.x);
+    if (ahead.y < 0.0) fat.y += ahead.y;
+    fat.height += std::abs(ahead.y);
+
+    RemoveLeaf(id);
+    nodes[id].aabb = fat;
+    InsertLeaf(id);
+    MarkMoved(id);
+}
+
+void DynamicAABBTree::MarkMoved(int32_t id) {
+    if (static_cast<size_t>(id) >= moved.size()) moved.resize(nodes.size(), 0);
+    if (moved[id]) return;
+    moved[id] = 1;
+    moveBuffer.push_back(id);
+}
+
+void DynamicAABBTree::Refit(int32_t index) {
+    Node& n = nodes[index];
+    const Node& c1 = nodes[n.child1];
+    const Node& c2 = nodes[n.child2];
+    n.aabb = c1.aabb.Union(c2.aabb);
+    n.height = 1 + std::max(c1.height, c2.height);
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+    if (root == NullNode) {
+        root = leaf;
+        nodes[root].parent = NullNode;
+        return;
+    }
+
+    // Descend towards the sibling that grows the total perimeter the least
+    const Rect2d leafAABB = nodes[leaf].aabb;
+    int32_t index = root;
+    while (!nodes[index].IsLeaf()) {
+        const Node& n = nodes[index];
+        double area = Perimeter(n.aabb);
+        double combined = Perimeter(n.aabb.Union(leafAABB));
+
+        // Cost of making a new parent for this node and the leaf
+        double cost = 2.0 * combined;
+        // Minimum cost of pushing the leaf further down
+        double inheritance = 2.0 * (combined - area);
+
+        auto descendCost = [&](int32_t child) {
+            const Node& c = nodes[child];
+            double grown = Perimeter(c.aabb.Union(leafAABB));
+            return (c.IsLeaf() ? grown : grown - Perimeter(c.aabb)) + inheritance;
+        };
+        double cost1 = descendCost(n.child1);
+        double cost2 = descendCost(n.child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = (cost1 < cost2) ? n.child1 : n.child2;
+    }
+
+    int32_t sibling = index;
+    int32_t oldParent = nodes[sibling].parent;
+    int32_t newParent = AllocateNode();
+
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].aabb = leafAABB.Union(nodes[sibling].aabb);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent == NullNode) {
+        root = newParent;
+    } else if (nodes[oldParent].child1 == sibling) {
+        nodes[oldParent].child1 = newParent;
+    } else {
+        nodes[oldParent].child2 = newParent;
+    }
+
+    // Walk back up, rebalancing and refitting ancestors
+    for (index = nodes[leaf].parent; index != NullNode; index = nodes[index].parent) {
+        index = Balance(index);
+        Refit(index);
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+    if (leaf == root) {
+        root = NullNode;
+        return;
+    }
+
+    int32_t parent = nodes[leaf].parent;
+    int32_t grandParent = nodes[parent].parent;
+    int32_t sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent == NullNode) {
+        root = sibling;
+        nodes[sibling].parent = NullNode;
+        FreeNode(parent);
+        return;
+    }
+
+    // Splice the sibling into the parent's place
+    if (nodes[grandParent].child1 == parent) nodes[grandParent].child1 = sibling;
+    else nodes[grandParent].child2 = sibling;
+    nodes[sibling].parent = grandParent;
+    FreeNode(parent);
+
+    for (int32_t index = grandParent; index != NullNode; index = nodes[index].parent) {
+        index = Balance(index);
+        Refit(index);
+    }
+}
+
+// Rotates the taller grandchild of a up when a's children differ in height
+// by more than one. Returns the index of the subtree root after rotation.
+int32_t DynamicAABBTree::Balance(int32_t iA) {
+    const Node& A = nodes[iA];
+    if (A.IsLeaf() || A.height < 2) return iA;
+
+    int32_t iB = A.child1;
+    int32_t iC = A.child2;
+    int32_t balance = nodes[iC].height - nodes[iB].height;
+
+    auto rotate = [&](int32_t iUp) {
+        // iUp takes A's place and keeps its taller child; A adopts the shorter one
+        Node& up = nodes[iUp];
+        int32_t iF = up.child1;
+        int32_t iG = up.child2;
+
+        up.child1 = iA;
+        up.parent = nodes[iA].parent;
+        nodes[iA].parent = iUp;
+
+        if (up.parent != NullNode) {
+            if (nodes[up.parent].child1 == iA) nodes[up.parent].child1 = iUp;
+            else nodes[up.parent].child2 = iUp;
+        } else {
+            root = iUp;
+        }
+
+        int32_t iKeep = (nodes[iF].height > nodes[iG].height) ? iF : iG;
+        int32_t iGive = (iKeep == iF) ? iG : iF;
+
+        up.child2 = iKeep;
+        if (nodes[iA].child1 == iUp) nodes[iA].child1 = iGive;
+        else nodes[iA].child2 = iGive;
+        nodes[iGive].parent = iA;
+
+        Refit(iA);
+        Refit(iUp);
+        return iUp;
+    };
+
+    if (balance > 1) return rotate(iC);
+    if (balance < -1) return rotate(iB);
+    return iA;
+}
+
+template <typename Descend, typename Visit>
+void DynamicAABBTree::Traverse(Descend&& descend, Visit&& visit) const {
+    if (root == NullNode) return;
+
+    int32_t stack[64];
+    std::vector<int32_t> overflow;
+    int top = 0;
+    stack[top++] = root;
+
+    while (top > 0 || !overflow.empty()) {
+        int32_t index;
+        if (!overflow.empty()) { index = overflow.back(); overflow.pop_back(); }
+        else index = stack[--top];
+
+        const Node& n = nodes[index];
+        if (!descend(n.aabb)) continue;
+
+        if (n.IsLeaf()) {
+            visit(index);
+            continue;
+        }
+
+        for (int32_t child : { n.child1, n.child2 }) {
+            if (top < 64) stack[top++] = child;
+            else overflow.push_back(child);
+        }
+    }
+}
+
+void DynamicAABBTree::UpdatePairs() {
+    if (moveBuffer.empty()) return;
+
+    // Pairs of moved proxies are found again below
+    fatPairs.erase(std::remove_if(fatPairs.begin(), fatPairs.end(),
+        [this](const ProxyPair& p) { return moved[p.first] || moved[p.second]; }), fatPairs.end());
+
+    newPairs.clear();
+    for (int32_t id : moveBuffer) {
+        const Node& n = nodes[id];
+        if (n.height != 0) continue; // destroyed, or reused as an inner node
+
+        Traverse(
+            [&n](const Rect2d& box) { return box.Intersects(n.aabb); },
+            [&](int32_t other) {
+                // Two moved leaves find each other twice; keep the lower id's find
+                if (other == id || (moved[other] && other < id)) return;
+                newPairs.emplace_back(std::min(id, other), std::max(id, other));
+            });
+    }
+
+    for (int32_t id : moveBuffer) moved[id] = 0;
+    moveBuffer.clear();
+
+    std::sort(newPairs.begin(), newPairs.end());
+    size_t kept = fatPairs.size();
+    fatPairs.insert(fatPairs.end(), newPairs.begin(), newPairs.end());
+    std::inplace_merge(fatPairs.begin(), fatPairs.begin() + kept, fatPairs.end());
+}
+
+void DynamicAABBTree::QueryPairs(std::vector<ProxyPair>& out) {
+    UpdatePairs();
+
+    // Fat bounds keep the pair, tight bounds decide whether it is reported
+    for (const auto& [a, b] : fatPairs)
+        if (nodes[a].tight.Intersects(nodes[b].tight))
+            out.emplace_back(a, b);
+}
+
+void DynamicAABBTree::QueryRegion(const Rect2d& region, std::vector<ProxyId>& out) const {
+    Traverse(
+        [&region](const Rect2d& box) { return box.Intersects(region); },
+        [&](int32_t leaf) {
+            if (nodes[leaf].tight.Intersects(region))
+                out.push_back(leaf);
+        });
+}
+
+void DynamicAABBTree::QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                               std::vector<ProxyId>& out) const {
+    double tEntry;
+    Traverse(
+        [&](const Rect2d& box) { return RayOverlapsAABB(origin, dir, maxDistance, box, tEntry); },
+        [&](int32_t leaf) {
+            if (RayOverlapsAABB(origin, dir, maxDistance, nodes[leaf].tight, tEntry))
+                out.push_back(leaf);
+        });
+}
+
+void DynamicAABBTree::Clear() {
+    nodes.clear();
+    root = NullNode;
+    freeList = NullNode;
+    fatPairs.clear();
+    moveBuffer.clear();
+    moved.clear();
+}
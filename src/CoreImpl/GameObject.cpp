@@ -7,7 +7,7 @@
 #include <stdexcept>
 #include "Core/World/ServerWorld.h"
 
-int GameObject::next_id = 0;
+std::atomic<int> GameObject::next_id = 0;
 
 GameObject::GameObject()
     : id(++next_id), shouldDestroy(false) {
@@ -19,6 +19,21 @@ GameObject::GameObject()
         LockComponent<TransformComponent>();
         LockComponent<HitboxComponent>();
         LockComponent<PhysicalPropertiesComponent>();
+
+        // Anchored geometry is cached by the world, which needs to hear about changes to it
+        GetHitbox()->Changed.ConnectPersistent([this]() {
+            collisionCategoryBits = GetHitbox()->GetCategoryBits();
+            collisionMaskBits = GetHitbox()->GetMaskBits();
+            const auto& hitboxes = GetHitbox()->GetHitboxes();
+            hasTriggers = std::any_of(hitboxes.begin(), hitboxes.end(), [](const Hitbox& hb) { return hb.isTrigger; });
+            if (world && physicsBody != PhysicsBodyStore::NullBody)
+                world->SetBodyLocalBounds(physicsBody, GetHitbox()->GetLocalBounds());
+            if (IsAnchored()) OnStaticGeometryChanged();
+            else Wake(); // its broadphase proxy needs refitting
+        });
+        GetPhysicalProperties()->AnchoredChanged.ConnectPersistent([this](bool) {
+            OnStaticGeometryChanged();
+        });
     }
 
 GameObject::~GameObject() {
@@ -30,12 +45,55 @@ Vector2d GameObject::GetPosition() const { return GetTransform()->GetPosition();
 
 void GameObject::SetPosition(const Vector2d& pos) {
     GetTransform()->SetPosition(pos);
-    Moved.Fire(pos);
+    if (IsAnchored()) OnStaticGeometryChanged();
+    NotifyMoved();
 }
 
 void GameObject::Move(const Vector2d& delta) {
     GetTransform()->Translate(delta);
-    if (delta.LengthSquared() != 0) Moved.Fire(GetPosition());
+    if (delta.LengthSquared() == 0) return;
+    if (IsAnchored()) OnStaticGeometryChanged();
+    NotifyMoved();
+}
+
+void GameObject::OnTagChanged(TagId tag, bool added) {
+    if (world) world->OnObjectTagChanged(this, tag, added);
+}
+
+void GameObject::OnComponentSet(ComponentTypeId id) {
+    if (world) world->OnObjectComponentSet(this, id);
+}
+
+void GameObject::NotifyMoved() {
+    if (world && world->IsRecordingEvents()) world->RecordMoved(this);
+    else Moved.Fire(GetPosition());
+}
+
+Rect2d GameObject::GetWorldBounds() const {
+    if (world && physicsBody != PhysicsBodyStore::NullBody) return world->GetBodies().GetBounds(physicsBody);
+    return GetHitbox()->GetLocalBounds().Translated(GetPosition());
+}
+
+Rect2d GameObject::GetSweptBounds() const {
+    if (world && physicsBody != PhysicsBodyStore::NullBody) return world->GetBodies().GetSweptBounds(physicsBody);
+    return GetWorldBounds();
+}
+
+bool GameObject::IsAnchored() const {
+    auto phys = GetPhysicalProperties();
+    return phys && phys->IsAnchored();
+}
+
+bool GameObject::IsSleeping() const {
+    return world && physicsBody != PhysicsBodyStore::NullBody && world->GetBodies().IsSleeping(physicsBody);
+}
+
+void GameObject::Wake() {
+    if (world && physicsBody != PhysicsBodyStore::NullBody) world->WakeBody(physicsBody);
+}
+
+void GameObject::OnStaticGeometryChanged() {
+    if (world) world->MarkStaticGeometryDirty();
 }
 
 void GameObject::SetDirty(bool val) {
@@ -51,8 +109,12 @@ void GameObject::Tick(float dt) {
 }
 
 void GameObject::Destroy() {
-    Destroyed.Fire();
+    bool queued = shouldDestroy;
+    if (!world || !world->IsRecordingEvents()) Destroyed.Fire();
+    else if (!queued) world->RecordDestroyed(this);
     shouldDestroy = true;
+    // Queued once, so the world never sees the same object twice
+    if (!queued && world) world->QueueDestroy(this);
 }
 
 TransformComponent* GameObject::GetTransform() const {
@@ -67,6 +129,12 @@ PhysicalPropertiesComponent* GameObject::GetPhysicalProperties() const {
     return GetComponent<PhysicalPropertiesComponent>();
 }
 
+void GameObject::BindPhysicsBody(PhysicsBodyStore* store, PhysicsBodyStore::BodyId id) {
+    physicsBody = id;
+    GetTransform()->BindBody(store, id);
+    GetPhysicalProperties()->BindBody(store, id);
+}
+
 void GameObject::SetVelocity(const Vector2d& v) { GetTransform()->SetVelocity(v); }
 Vector2d GameObject::GetVelocity() const { return GetTransform()->GetVelocity(); }
 
@@ -1,5 +1,6 @@
 #include "../Core/Instance.h"
 #include "../Core/Components/ComponentRegistry.h"
+#include "../Core/World/World.h"
 
 Instance::~Instance() {
     if (!destroyed) {
@@ -7,8 +8,8 @@ Instance::~Instance() {
         Destroyed.Fire();
     }
 
-    for (auto& [type, comp] : components)
-        comp->OnDetach();
+    for (auto& comp : components)
+        if (comp) comp->OnDetach();
 
     components.clear();
 }
@@ -18,31 +19,47 @@ World* Instance::GetWorld() const { return world; }
 
 void Instance::Tick(float dt) {
     if (destroyed) return;
-    for (auto& [type, comp] : components) {
-        if (comp->IsEnabled())
-            comp->Tick(dt);
+    for (ComponentTypeId id = 0; id < components.size(); ++id) {
+        if (ticking[id] && components[id]->IsEnabled())
+            components[id]->Tick(dt);
     }
 }
 
 void Instance::Destroy() {
     if (destroyed) return;
     destroyed = true;
-    for (auto& [type, comp] : components)
-        comp->OnDetach();
+    for (auto& comp : components)
+        if (comp) comp->OnDetach();
     Destroyed.Fire();
     components.clear();
+    ticking.reset();
 }
 
 void Instance::Encode(PacketCodec& codec) const {
     codec.WriteUUID(uuid);
-    codec.WriteStringArray(tags);
+    // Fixed atoms go as they are; other atoms are local to this process, so
+    // those go as Tags::Null followed by the name, for the receiver to intern
+    codec.Write<uint16_t>(static_cast<uint16_t>(tags.Size()));
+    for (TagId tag : tags) {
+        if (Tags::IsBuiltin(tag)) {
+            codec.Write<uint16_t>(tag);
+        } else {
+            codec.Write<uint16_t>(Tags::Null);
+            codec.WriteString(Tags::GetName(tag));
+        }
+    }
 
     // Write component count
-    codec.Write<uint32_t>((uint32_t)components.size());
+    uint32_t count = 0;
+    for (const auto& comp : components) count += comp != nullptr;
+    codec.Write<uint32_t>(count);
+
+    for (ComponentTypeId id = 0; id < components.size(); ++id) {
+        const auto& comp = components[id];
+        if (!comp) continue;
 
-    for (const auto& [type, comp] : components) {
         // Each component type should have a registered string or ID
-        std::string typeName = ComponentRegistry::GetName(type);
+        std::string typeName = ComponentRegistry::GetName(id);
         codec.WriteString(typeName);
 
         comp->Encode(codec);
@@ -50,35 +67,49 @@ void Instance::Encode(PacketCodec& codec) const {
 }
 
 void Instance::Decode(PacketCodec& codec) {
+    UUID previous = uuid;
     uuid = codec.ReadUUID();
-    tags = codec.ReadStringArray();
+    if (world && uuid != previous) world->ReindexUuid(previous, uuid);
+    TagSet decoded;
+    uint16_t tagCount = codec.Read<uint16_t>();
+    for (uint16_t i = 0; i < tagCount; ++i) {
+        TagId tag = codec.Read<uint16_t>();
+        if (tag == Tags::Null) tag = Tags::Intern(codec.ReadString());
+        else if (!Tags::IsBuiltin(tag)) throw std::runtime_error("[Instance] unknown built-in tag " + std::to_string(tag));
+        decoded.Add(tag);
+    }
+    // Through RemoveTag / AddTag, so whoever indexes this instance's tags hears of it
+    while (!tags.Empty()) RemoveTag(*tags.begin());
+    for (TagId tag : decoded) AddTag(tag);
 
     uint32_t compCount = codec.Read<uint32_t>();
 
     for (uint32_t i = 0; i < compCount; ++i) {
         std::string typeName = codec.ReadString();
 
-        auto comp = ComponentRegistry::Create(typeName);
+        ComponentTypeId id;
+        bool ticks;
+        auto comp = ComponentRegistry::Create(typeName, &id, &ticks);
         if (!comp) {
             std::cerr << "[Instance] Unknown component type: " << typeName << "\n";
             continue;
         }
 
-        auto& ref = *comp;
         comp->OnAttach(this);
         comp->Decode(codec);
-        components[std::type_index(typeid(ref))] = std::move(comp);
+        SetComponentSlot(id, std::move(comp));
+        ticking[id] = ticks;
     }
 }
 
 std::string Instance::Dump() const {
     std::string current = "Instance(UUID=" + uuid.to_string() + ", Tags=[" +
             std::accumulate(tags.begin(), tags.end(), std::string(""),
-                            [](const std::string& a, const Tag& b) {
-                                return a + (a.empty() ? "" : ", ") + b;
+                            [](const std::string& a, TagId b) {
+                                return a + (a.empty() ? "" : ", ") + Tags::GetName(b);
                             }) + "])\n";
-    for (auto& [id, comp] : components) {
-        current += comp->Dump() + '\n';
+    for (auto& comp : components) {
+        if (comp) current += comp->Dump() + '\n';
     }
     return current; 
 }
\ No newline at end of file
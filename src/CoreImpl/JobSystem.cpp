@@ -0,0 +1,172 @@
+#include "Core/JobSystem.h"
+
+namespace {
+    // Which system and worker the current thread belongs to, if any
+    thread_local const JobSystem* currentSystem = nullptr;
+    thread_local size_t currentWorker = 0;
+}
+
+JobSystem::JobSystem(size_t threads) {
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+        workers.push_back(std::make_unique<Worker>());
+
+    // Started only once every deque exists, since workers steal from all of them
+    for (size_t i = 0; i < threads; ++i)
+        workers[i]->thread = std::thread([this, i] { WorkerLoop(i); });
+}
+
+JobSystem::~JobSystem() {
+    while (TryRunOne()) {}
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) worker->thread.join();
+}
+
+void JobSystem::Schedule(std::function<void()> fn, JobCounter* counter) {
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+    Push({ std::move(fn), counter });
+}
+
+void JobSystem::ScheduleAfter(JobCounter& dependency, std::function<void()> fn, JobCounter* counter) {
+    if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        // Finish() takes the continuations under the same lock once the count hits
+        // zero, so a continuation is either queued here or picked up there
+        std::lock_guard<std::mutex> lock(dependency.mutex);
+        if (!dependency.IsDone()) {
+            dependency.continuations.push_back({ std::move(fn), counter });
+            return;
+        }
+    }
+    Push({ std::move(fn), counter });
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!TryRunOne()) std::this_thread::yield();
+    }
+    // See Finish: wait out the job that brought the count to zero
+    std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+void JobSystem::Run(size_t chunks, const std::function<void(size_t)>& fn) {
+    if (chunks == 0) return;
+    if (workers.empty() || chunks == 1) {
+        for (size_t i = 0; i < chunks; ++i) fn(i);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t i = 1; i < chunks; ++i)
+        Schedule([&fn, i] { fn(i); }, &counter);
+
+    // The first chunk runs here rather than waiting in a queue
+    fn(0);
+    Wait(counter);
+}
+
+void JobSystem::Push(Job job) {
+    Queue& queue = (currentSystem == this) ? workers[currentWorker]->queue : shared;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    // A worker about to sleep registers in `sleeping` before it re-checks `queued`,
+    // so one of the two sides always sees the other
+    queued.fetch_add(1);
+    if (sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_one();
+    }
+}
+
+bool JobSystem::TryPop(Job& job) {
+    auto take = [&](Queue& queue, bool back) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) return false;
+
+        if (back) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    };
+
+    bool isWorker = currentSystem == this;
+    size_t self = isWorker ? currentWorker : 0;
+
+    // Newest own job first: it is the most likely to still be in cache
+    if (isWorker && take(workers[self]->queue, true)) return true;
+    if (take(shared, false)) return true;
+
+    for (size_t i = 0; i < workers.size(); ++i) {
+        size_t victim = (self + 1 + i) % workers.size();
+        if (isWorker && victim == self) continue;
+        if (take(workers[victim]->queue, false)) {
+            stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JobSystem::TryRunOne() {
+    Job job;
+    if (!TryPop(job)) return false;
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job& job) {
+    job.fn();
+    executed.fetch_add(1, std::memory_order_relaxed);
+    Finish(job.counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+    if (!counter) return;
+
+    uint32_t pending = counter->pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter->pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed))
+            return;
+    }
+
+    // The last job drops the count under the lock, which Wait takes before returning,
+    // so the counter cannot be freed while this is still using it
+    std::vector<JobCounter::Continuation> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            ready.swap(counter->continuations);
+    }
+    for (auto& continuation : ready)
+        Push({ std::move(continuation.fn), continuation.counter });
+}
+
+void JobSystem::WorkerLoop(size_t index) {
+    currentSystem = this;
+    currentWorker = index;
+
+    while (true) {
+        if (TryRunOne()) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleeping.fetch_add(1);
+        wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+        sleeping.fetch_sub(1);
+        if (stopping && queued.load() == 0) return;
+    }
+}
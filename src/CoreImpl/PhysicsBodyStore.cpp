@@ -0,0 +1,103 @@
+#include "Core/World/PhysicsBodyStore.h"
+#include "Core/Objects/GameObject.h"
+
+PhysicsBodyStore::BodyId PhysicsBodyStore::Add(GameObject* obj) {
+    BodyId id = static_cast<BodyId>(owners.size());
+
+    x.push_back(0); y.push_back(0);
+    px.push_back(0); py.push_back(0);
+    vx.push_back(0); vy.push_back(0);
+    ax.push_back(0); ay.push_back(0);
+    invMass.push_back(0);
+    flags.push_back(0);
+    restTicks.push_back(0);
+    localBounds.push_back(obj->GetHitbox()->GetLocalBounds());
+    bounds.emplace_back(); sweptBounds.emplace_back();
+    owners.push_back(obj);
+
+    // Components copy their current state in
+    obj->BindPhysicsBody(this, id);
+    px[id] = x[id]; py[id] = y[id];
+    return id;
+}
+
+void PhysicsBodyStore::Remove(BodyId id) {
+    // Components copy the body's state back out before the slot is reused
+    owners[id]->BindPhysicsBody(nullptr, NullBody);
+
+    BodyId last = static_cast<BodyId>(owners.size() - 1);
+    if (id != last) {
+        x[id] = x[last]; y[id] = y[last];
+        px[id] = px[last]; py[id] = py[last];
+        vx[id] = vx[last]; vy[id] = vy[last];
+        ax[id] = ax[last]; ay[id] = ay[last];
+        invMass[id] = invMass[last];
+        flags[id] = flags[last];
+        restTicks[id] = restTicks[last];
+        localBounds[id] = localBounds[last];
+        bounds[id] = bounds[last]; sweptBounds[id] = sweptBounds[last];
+        owners[id] = owners[last];
+        owners[id]->BindPhysicsBody(this, id);
+    }
+
+    x.pop_back(); y.pop_back();
+    px.pop_back(); py.pop_back();
+    vx.pop_back(); vy.pop_back();
+    ax.pop_back(); ay.pop_back();
+    invMass.pop_back();
+    flags.pop_back();
+    restTicks.pop_back();
+    localBounds.pop_back();
+    bounds.pop_back(); sweptBounds.pop_back();
+    owners.pop_back();
+}
+
+void PhysicsBodyStore::Clear() {
+    while (!owners.empty())
+        Remove(static_cast<BodyId>(owners.size() - 1));
+}
+
+void PhysicsBodyStore::SetMassProperties(BodyId id, float mass, bool anchored) {
+    invMass[id] = (anchored || mass <= 0.0f) ? 0.0f : 1.0f / mass;
+    flags[id] = anchored ? (flags[id] | Anchored) : (flags[id] & ~Anchored);
+    Wake(id);
+}
+
+void PhysicsBodyStore::Integrate(double dt) {
+    for (BodyId i = 0; i < owners.size(); ++i) {
+        if (flags[i] & (Anchored | Sleeping)) continue;
+        vx[i] += ax[i] * dt;
+        vy[i] += ay[i] * dt;
+    }
+}
+
+void PhysicsBodyStore::UpdateSleep(double maxVelocity, double maxAcceleration, uint32_t ticks) {
+    double maxVelocitySq = maxVelocity * maxVelocity;
+    double maxAccelerationSq = maxAcceleration * maxAcceleration;
+
+    sleepingCount = awakeCount = 0;
+    for (BodyId i = 0; i < owners.size(); ++i) {
+        if (flags[i] & Anchored) continue;
+
+        if (flags[i] & Sleeping) {
+            if (ticks != 0) {
+                ++sleepingCount;
+                continue;
+            }
+            Wake(i);
+        }
+
+        bool still = vx[i] * vx[i] + vy[i] * vy[i] <= maxVelocitySq &&
+                     ax[i] * ax[i] + ay[i] * ay[i] <= maxAccelerationSq;
+        restTicks[i] = still ? restTicks[i] + 1 : 0;
+
+        if (ticks != 0 && restTicks[i] >= ticks) {
+            // Drop the residual drift so the body stays exactly where it fell asleep
+            flags[i] |= Sleeping;
+            vx[i] = vy[i] = 0;
+            ++sleepingCount;
+        } else {
+            ++awakeCount;
+        }
+    }
+}
@@ -0,0 +1,294 @@
+#include "Core/World/ShardedWorld.h"
+#include "Core/World/ServerWorld.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Stands in for an object owned by another region. Its collisions are held in the
+// region's list until every region is done ticking.
+class ShardedWorld::GhostObject : public GameObject {
+public:
+    GhostObject(GameObject& source, std::vector<std::pair<GhostObject*, GameObject*>>& collisions)
+        : source(source), collisions(collisions) {
+        standIn = true;
+    }
+
+    GameObject& source;
+    size_t owner = 0; // region owning source
+    uint32_t hitboxRevision = 0; // of source's hitboxes when last copied
+
+    void OnCollision(GameObject* other) override {
+        collisions.emplace_back(this, other);
+    }
+
+    void CopyHitboxes() {
+        auto from = source.GetHitbox();
+        hitboxRevision = from->GetRevision();
+        GetHitbox()->ClearHitboxes();
+        for (const auto& hb : from->GetHitboxes())
+            GetHitbox()->AddHitbox(hb.shape, hb.group, hb.isTrigger);
+    }
+
+private:
+    std::vector<std::pair<GhostObject*, GameObject*>>& collisions;
+};
+
+ShardedWorld::ShardedWorld(bool isServer, const ShardSettings& settings)
+    : settings(settings), ownedJobs(std::make_unique<JobSystem>(settings.threads)), jobs(ownedJobs.get()) {
+    if (settings.columns == 0 || settings.rows == 0)
+        throw std::invalid_argument("[ShardedWorld] the region grid needs at least one column and one row");
+    if (!(settings.regionSize > 0.0))
+        throw std::invalid_argument("[ShardedWorld] regionSize must be positive");
+    if (!(settings.haloWidth >= 0.0))
+        throw std::invalid_argument("[ShardedWorld] haloWidth must not be negative");
+
+    regions.resize(static_cast<size_t>(settings.columns) * settings.rows);
+    for (auto& region : regions) {
+        if (isServer) {
+            auto server = std::make_unique<ServerWorld>();
+            region.server = server.get();
+            region.world = std::move(server);
+        } else {
+            region.world = std::make_unique<World>(false);
+        }
+        region.world->SetPhysicsSettings(settings.physics);
+    }
+}
+
+ShardedWorld::~ShardedWorld() = default;
+
+void ShardedWorld::SetJobSystem(JobSystem* shared) {
+    if (shared) {
+        jobs = shared;
+        ownedJobs.reset();
+    } else if (!ownedJobs) {
+        ownedJobs = std::make_unique<JobSystem>(settings.threads);
+        jobs = ownedJobs.get();
+    }
+
+    for (auto& region : regions) region.world->SetJobSystem(shared);
+}
+
+int ShardedWorld::CellX(double x) const {
+    double c = std::floor((x - settings.origin.x) / settings.regionSize);
+    if (!(c >= 0.0)) return 0;
+    return static_cast<int>(std::min(c, static_cast<double>(settings.columns - 1)));
+}
+
+int ShardedWorld::CellY(double y) const {
+    double c = std::floor((y - settings.origin.y) / settings.regionSize);
+    if (!(c >= 0.0)) return 0;
+    return static_cast<int>(std::min(c, static_cast<double>(settings.rows - 1)));
+}
+
+size_t ShardedWorld::GetRegionIndex(const Vector2d& point) const {
+    return static_cast<size_t>(CellY(point.y)) * settings.columns + CellX(point.x);
+}
+
+size_t ShardedWorld::GetOwnerRegion(const GameObject& obj) const {
+    auto hitbox = obj.GetHitbox();
+    if (!hitbox || hitbox->GetHitboxes().empty()) return GetRegionIndex(obj.GetPosition());
+    Rect2d bounds = obj.GetWorldBounds();
+    return GetRegionIndex({ bounds.x + bounds.width * 0.5, bounds.y + bounds.height * 0.5 });
+}
+
+GameObject& ShardedWorld::AddObject(std::unique_ptr<GameObject> obj) {
+    if (!obj) throw std::invalid_argument("[ShardedWorld] cannot add a null GameObject");
+
+    GameObject& ref = *obj;
+    regions[GetOwnerRegion(ref)].world->AddObject(std::move(obj));
+    return ref;
+}
+
+void ShardedWorld::RemoveObject(const GameObject* obj) {
+    if (!obj || IsGhost(obj)) return;
+
+    // Its ghosts go with it, so neighbours stop colliding with it right away
+    for (auto& pair : forwarded)
+        if (pair.first == obj || pair.second == obj) pair = { nullptr, nullptr };
+
+    UUID id = obj->GetUUID();
+    for (auto& region : regions) {
+        auto it = region.ghosts.find(id);
+        if (it == region.ghosts.end()) continue;
+
+        region.ghostObjects.erase(it->second.object);
+        region.world->RemoveObject(it->second.object);
+        region.ghosts.erase(it);
+    }
+
+    for (auto& region : regions)
+        if (region.world->ReleaseObject(obj)) return;
+}
+
+void ShardedWorld::CollectReplication(ReplicationPacket& packet) {
+    for (auto& region : regions)
+        if (region.server) region.server->CollectReplication(packet);
+}
+
+void ShardedWorld::ProcessReplicationQueue(NetworkSystem& network) {
+    if (regions.empty() || !regions.front().server) return;
+
+    ReplicationPacket packet;
+    CollectReplication(packet);
+    packet.EncodeObjects(*jobs);
+    network.broadcast(packet);
+}
+
+bool ShardedWorld::IsGhost(const GameObject* obj) const {
+    for (const auto& region : regions)
+        if (region.ghostObjects.count(obj)) return true;
+    return false;
+}
+
+size_t ShardedWorld::GetObjectCount() const {
+    size_t count = 0;
+    for (const auto& region : regions)
+        count += region.world->GetObjects().size() - region.ghostObjects.size();
+    return count;
+}
+
+size_t ShardedWorld::GetGhostCount() const {
+    size_t count = 0;
+    for (const auto& region : regions) count += region.ghostObjects.size();
+    return count;
+}
+
+void ShardedWorld::Tick(float dt) {
+    MigrateObjects();
+    RefreshGhosts();
+
+    jobs->Run(regions.size(), [this, dt](size_t i) {
+        regions[i].world->Tick(dt);
+    });
+
+    ForwardGhostCollisions();
+}
+
+void ShardedWorld::ForwardGhostCollisions() {
+    forwarded.clear();
+    forwardedKeys.clear();
+
+    for (auto& region : regions) {
+        for (auto [ghost, other] : region.ghostCollisions) {
+            GameObject* a = &ghost->source;
+            GameObject* b = other;
+            if (other->IsStandIn()) {
+                // Both are ghosts here; a region owning both sees them collide itself
+                auto* otherGhost = static_cast<GhostObject*>(other);
+                if (otherGhost->owner == ghost->owner) continue;
+                b = &otherGhost->source;
+            }
+            if (a == b) continue;
+
+            auto key = std::less<const GameObject*>()(a, b) ? std::make_pair(a, b) : std::make_pair(b, a);
+            if (forwardedKeys.insert(key).second) forwarded.emplace_back(a, b);
+        }
+        region.ghostCollisions.clear();
+    }
+
+    // Indexed loop: listeners may remove objects, which nulls their entries
+    for (size_t i = 0; i < forwarded.size(); ++i) {
+        auto [a, b] = forwarded[i];
+        if (!a || !b) continue;
+        a->OnCollision(b);
+        if (forwarded[i].first && forwarded[i].second)
+            b->OnCollision(a);
+    }
+    forwarded.clear();
+}
+
+void ShardedWorld::MigrateObjects() {
+    migrations = 0;
+
+    for (size_t index = 0; index < regions.size(); ++index) {
+        Region& region = regions[index];
+
+        leaving.clear();
+        for (const auto& obj : region.world->GetObjects()) {
+            if (region.ghostObjects.count(obj.get())) continue;
+
+            size_t owner = GetOwnerRegion(*obj);
+            if (owner != index) leaving.emplace_back(obj.get(), owner);
+        }
+
+        for (auto [obj, owner] : leaving) {
+            regions[owner].world->AddObject(region.world->ReleaseObject(obj));
+            // Its queued replication stayed behind with its old handle
+            if (obj->IsDirty()) obj->SetDirty();
+            ++migrations;
+        }
+    }
+}
+
+void ShardedWorld::RefreshGhosts() {
+    ++refreshStamp;
+
+    for (size_t index = 0; index < regions.size(); ++index) {
+        Region& region = regions[index];
+
+        for (const auto& obj : region.world->GetObjects()) {
+            if (region.ghostObjects.count(obj.get())) continue;
+
+            auto hitbox = obj->GetHitbox();
+            if (!hitbox || hitbox->GetHitboxes().empty()) continue;
+
+            Rect2d reach = obj->GetWorldBounds().Expanded(settings.haloWidth);
+            int x0 = CellX(reach.Left()), x1 = CellX(reach.Right());
+            int y0 = CellY(reach.Top()), y1 = CellY(reach.Bottom());
+
+            for (int y = y0; y <= y1; ++y) {
+                for (int x = x0; x <= x1; ++x) {
+                    size_t cell = static_cast<size_t>(y) * settings.columns + x;
+                    if (cell != index) UpdateGhost(regions[cell], index, *obj);
+                }
+            }
+        }
+    }
+
+    // Ghosts whose source moved away, migrated in or was removed
+    for (auto& region : regions) {
+        staleGhosts.clear();
+        for (auto it = region.ghosts.begin(); it != region.ghosts.end();) {
+            if (it->second.stamp == refreshStamp) {
+                ++it;
+                continue;
+            }
+            staleGhosts.push_back(it->second.object);
+            region.ghostObjects.erase(it->second.object);
+            it = region.ghosts.erase(it);
+        }
+
+        for (GameObject* ghost : staleGhosts)
+            region.world->RemoveObject(ghost);
+    }
+}
+
+void ShardedWorld::UpdateGhost(Region& region, size_t owner, GameObject& source) {
+    auto [it, inserted] = region.ghosts.try_emplace(source.GetUUID(), Ghost{ nullptr, 0 });
+    Ghost& ghost = it->second;
+    ghost.stamp = refreshStamp;
+
+    if (inserted) {
+        auto copy = std::make_unique<GhostObject>(source, region.ghostCollisions);
+        copy->CopyHitboxes();
+        copy->GetPhysicalProperties()->SetMass(source.GetPhysicalProperties()->GetMass());
+        copy->GetPhysicalProperties()->SetAnchored(source.IsAnchored());
+        copy->SetPosition(source.GetPosition());
+
+        ghost.object = copy.get();
+        region.ghostObjects.insert(copy.get());
+        region.world->AddObject(std::move(copy));
+    }
+
+    // Only touch what changed, so resting ghosts neither wake nor dirty the static layer
+    GhostObject& g = *ghost.object;
+    g.owner = owner;
+    if (g.hitboxRevision != source.GetHitbox()->GetRevision()) g.CopyHitboxes();
+    float mass = source.GetPhysicalProperties()->GetMass();
+    if (g.GetPhysicalProperties()->GetMass() != mass) g.GetPhysicalProperties()->SetMass(mass);
+    if (g.IsAnchored() != source.IsAnchored()) g.GetPhysicalProperties()->SetAnchored(source.IsAnchored());
+    if (g.GetPosition() != source.GetPosition()) g.SetPosition(source.GetPosition());
+    if (g.GetVelocity() != source.GetVelocity()) g.SetVelocity(source.GetVelocity());
+    if (g.GetAcceleration() != source.GetAcceleration()) g.SetAcceleration(source.GetAcceleration());
+}
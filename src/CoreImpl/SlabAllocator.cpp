@@ -0,0 +1,93 @@
+#include "Core/SlabAllocator.h"
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace {
+    constexpr size_t ClassCount = SlabAllocator::MaxBlockSize / SlabAllocator::Granularity;
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        std::mutex mutex;
+        FreeBlock* free = nullptr;
+    };
+
+    // Never destroyed, so objects freed during static destruction still find it
+    struct Pools {
+        SizeClass classes[ClassCount];
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> systemAllocations{0};
+        std::atomic<uint64_t> liveBlocks{0};
+    };
+
+    Pools& GetPools() {
+        static Pools* pools = new Pools();
+        return *pools;
+    }
+
+    size_t ClassIndex(size_t size) {
+        return (size + SlabAllocator::Granularity - 1) / SlabAllocator::Granularity - 1;
+    }
+}
+
+void* SlabAllocator::Allocate(size_t size) {
+    Pools& pools = GetPools();
+    pools.allocations.fetch_add(1, std::memory_order_relaxed);
+    pools.liveBlocks.fetch_add(1, std::memory_order_relaxed);
+
+    if (size == 0) size = 1;
+    if (size > MaxBlockSize) {
+        pools.systemAllocations.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    size_t index = ClassIndex(size);
+    size_t blockSize = (index + 1) * Granularity;
+    SizeClass& sizeClass = pools.classes[index];
+
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    if (!sizeClass.free) {
+        // Carve a new slab into blocks; the slab itself is never freed
+        pools.systemAllocations.fetch_add(1, std::memory_order_relaxed);
+        char* slab = static_cast<char*>(::operator new(SlabSize));
+        for (size_t offset = 0; offset + blockSize <= SlabSize; offset += blockSize) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + offset);
+            block->next = sizeClass.free;
+            sizeClass.free = block;
+        }
+    }
+
+    FreeBlock* block = sizeClass.free;
+    sizeClass.free = block->next;
+    return block;
+}
+
+void SlabAllocator::Free(void* block, size_t size) noexcept {
+    if (!block) return;
+    Pools& pools = GetPools();
+    pools.liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+
+    if (size == 0) size = 1;
+    if (size > MaxBlockSize) {
+        ::operator delete(block);
+        return;
+    }
+
+    SizeClass& sizeClass = pools.classes[ClassIndex(size)];
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    auto* freed = static_cast<FreeBlock*>(block);
+    freed->next = sizeClass.free;
+    sizeClass.free = freed;
+}
+
+SlabAllocator::Stats SlabAllocator::GetStats() {
+    Pools& pools = GetPools();
+    Stats stats;
+    stats.allocations = pools.allocations.load(std::memory_order_relaxed);
+    stats.systemAllocations = pools.systemAllocations.load(std::memory_order_relaxed);
+    stats.liveBlocks = pools.liveBlocks.load(std::memory_order_relaxed);
+    return stats;
+}
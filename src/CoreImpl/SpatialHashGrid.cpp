@@ -0,0 +1,209 @@
+#include "Core/World/SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+SpatialHashGrid::SpatialHashGrid(double cellSize)
+    : cellSize(cellSize), invCellSize(1.0 / cellSize) {
+    if (cellSize <= 0.0) throw std::invalid_argument("[SpatialHashGrid] cell size must be positive");
+}
+
+SpatialHashGrid::CellRange SpatialHashGrid::ComputeRange(const Rect2d& aabb) const {
+    return {
+        static_cast<int32_t>(std::floor(aabb.Left() * invCellSize)),
+        static_cast<int32_t>(std::floor(aabb.Top() * invCellSize)),
+        static_cast<int32_t>(std::floor(aabb.Right() * invCellSize)),
+        static_cast<int32_t>(std::floor(aabb.Bottom() * invCellSize))
+    };
+}
+
+void SpatialHashGrid::Insert(ProxyId id, const CellRange& range) {
+    if (occupied.maxX < occupied.minX) {
+        occupied = range;
+    } else {
+        occupied.minX = std::min(occupied.minX, range.minX);
+        occupied.minY = std::min(occupied.minY, range.minY);
+        occupied.maxX = std::max(occupied.maxX, range.maxX);
+        occupied.maxY = std::max(occupied.maxY, range.maxY);
+    }
+    for (int32_t cx = range.minX; cx <= range.maxX; ++cx)
+        for (int32_t cy = range.minY; cy <= range.maxY; ++cy)
+            cells[CellKey(cx, cy)].push_back(id);
+}
+
+void SpatialHashGrid::Remove(ProxyId id, const CellRange& range) {
+    for (int32_t cx = range.minX; cx <= range.maxX; ++cx) {
+        for (int32_t cy = range.minY; cy <= range.maxY; ++cy) {
+            auto it = cells.find(CellKey(cx, cy));
+            if (it == cells.end()) continue;
+
+            auto& bucket = it->second;
+            auto pos = std::find(bucket.begin(), bucket.end(), id);
+            if (pos != bucket.end()) {
+                *pos = bucket.back();
+                bucket.pop_back();
+            }
+            if (bucket.empty()) cells.erase(it);
+        }
+    }
+}
+
+SpatialHashGrid::ProxyId SpatialHashGrid::CreateProxy(const Rect2d& aabb, GameObject* object) {
+    ProxyId id;
+    if (!freeList.empty()) {
+        id = freeList.back();
+        freeList.pop_back();
+    } else {
+        id = static_cast<ProxyId>(proxies.size());
+        proxies.emplace_back();
+    }
+
+    Proxy& p = proxies[id];
+    p.aabb = aabb;
+    p.object = object;
+    p.cells = ComputeRange(aabb);
+    p.alive = true;
+    Insert(id, p.cells);
+    return id;
+}
+
+void SpatialHashGrid::DestroyProxy(ProxyId id) {
+    if (id < 0 || id >= static_cast<ProxyId>(proxies.size()) || !proxies[id].alive) return;
+
+    Proxy& p = proxies[id];
+    Remove(id, p.cells);
+    p = Proxy{};
+    freeList.push_back(id);
+}
+
+void SpatialHashGrid::MoveProxy(ProxyId id, const Rect2d& aabb) {
+    Proxy& p = proxies[id];
+    p.aabb = aabb;
+
+    CellRange range = ComputeRange(aabb);
+    if (range == p.cells) return;
+
+    Remove(id, p.cells);
+    p.cells = range;
+    Insert(id, p.cells);
+}
+
+void SpatialHashGrid::SetCellSize(double size) {
+    if (size <= 0.0) throw std::invalid_argument("[SpatialHashGrid] cell size must be positive");
+    if (size == cellSize) return;
+
+    cellSize = size;
+    invCellSize = 1.0 / size;
+
+    cells.clear();
+    occupied = {};
+    for (ProxyId id = 0; id < static_cast<ProxyId>(proxies.size()); ++id) {
+        Proxy& p = proxies[id];
+        if (!p.alive) continue;
+        p.cells = ComputeRange(p.aabb);
+        Insert(id, p.cells);
+    }
+}
+
+void SpatialHashGrid::QueryPairs(std::vector<ProxyPair>& out) {
+    size_t first = out.size();
+
+    for (const auto& [key, bucket] : cells) {
+        if (bucket.size() < 2) continue;
+
+        int32_t cx = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+        int32_t cy = static_cast<int32_t>(static_cast<uint32_t>(key));
+
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            const Proxy& a = proxies[bucket[i]];
+            for (size_t j = i + 1; j < bucket.size(); ++j) {
+                const Proxy& b = proxies[bucket[j]];
+
+                // A pair sharing several cells is only reported from the first shared one
+                if (cx != std::max(a.cells.minX, b.cells.minX) || cy != std::max(a.cells.minY, b.cells.minY))
+                    continue;
+                if (!a.aabb.Intersects(b.aabb))
+                    continue;
+
+                out.emplace_back(std::min(bucket[i], bucket[j]), std::max(bucket[i], bucket[j]));
+            }
+        }
+    }
+
+    std::sort(out.begin() + first, out.end());
+}
+
+void SpatialHashGrid::QueryRegion(const Rect2d& region, std::vector<ProxyId>& out) const {
+    Query(region, [&out](ProxyId id) { out.push_back(id); });
+}
+
+void SpatialHashGrid::QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                               std::vector<ProxyId>& out) const {
+    size_t first = out.size();
+
+    if (occupied.maxX < occupied.minX) return;
+
+    // Clip the ray to the occupied cells, so the walk ends even for an infinite ray
+    double tEnter = 0.0, tExit = maxDistance;
+    auto clip = [&tEnter, &tExit](double o, double d, double lo, double hi) {
+        if (d == 0.0) return lo <= o && o <= hi;
+        double t0 = (lo - o) / d, t1 = (hi - o) / d;
+        if (t0 > t1) std::swap(t0, t1);
+        tEnter = std::max(tEnter, t0);
+        tExit = std::min(tExit, t1);
+        return tEnter <= tExit;
+    };
+    if (!clip(origin.x, dir.x, occupied.minX * cellSize, (occupied.maxX + 1) * cellSize) ||
+        !clip(origin.y, dir.y, occupied.minY * cellSize, (occupied.maxY + 1) * cellSize))
+        return;
+
+    // Walk the cells the clipped segment passes through (Amanatides & Woo)
+    Vector2d start = origin + dir * tEnter;
+    int32_t cx = std::clamp(static_cast<int32_t>(std::floor(start.x * invCellSize)), occupied.minX, occupied.maxX);
+    int32_t cy = std::clamp(static_cast<int32_t>(std::floor(start.y * invCellSize)), occupied.minY, occupied.maxY);
+    int32_t stepX = dir.x > 0.0 ? 1 : -1;
+    int32_t stepY = dir.y > 0.0 ? 1 : -1;
+
+    auto firstCrossing = [this, tEnter](double o, double d, int32_t c) -> double {
+        if (d == 0.0) return INFINITY;
+        double boundary = (d > 0.0 ? c + 1 : c) * cellSize;
+        return tEnter + (boundary - o) / d;
+    };
+    double tNextX = firstCrossing(start.x, dir.x, cx);
+    double tNextY = firstCrossing(start.y, dir.y, cy);
+    double tDeltaX = dir.x == 0.0 ? INFINITY : cellSize / std::abs(dir.x);
+    double tDeltaY = dir.y == 0.0 ? INFINITY : cellSize / std::abs(dir.y);
+
+    double t = tEnter;
+    while (t <= tExit) {
+        auto it = cells.find(CellKey(cx, cy));
+        if (it != cells.end()) {
+            for (ProxyId id : it->second) {
+                double tEntry;
+                if (RayOverlapsAABB(origin, dir, maxDistance, proxies[id].aabb, tEntry))
+                    out.push_back(id);
+            }
+        }
+
+        if (tNextX < tNextY) {
+            t = tNextX;
+            tNextX += tDeltaX;
+            cx += stepX;
+        } else {
+            t = tNextY;
+            tNextY += tDeltaY;
+            cy += stepY;
+        }
+    }
+
+    // Proxies spanning several visited cells were reported once per cell
+    std::sort(out.begin() + first, out.end());
+    out.erase(std::unique(out.begin() + first, out.end()), out.end());
+}
+
+void SpatialHashGrid::Clear() {
+    proxies.clear();
+    freeList.clear();
+    cells.clear();
+    occupied = {};
+}
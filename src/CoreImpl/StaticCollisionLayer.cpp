@@ -0,0 +1,65 @@
+#include "Core/World/StaticCollisionLayer.h"
+#include "Core/World/IBroadphase.h"
+#include <algorithm>
+
+void StaticCollisionLayer::Build(std::vector<Entry>& entries) {
+    items.swap(entries);
+    entries.clear();
+    nodes.clear();
+
+    if (items.empty()) return;
+
+    nodes.reserve(2 * (items.size() / LeafSize + 1));
+    BuildRange(0, static_cast<uint32_t>(items.size()));
+}
+
+uint32_t StaticCollisionLayer::BuildRange(uint32_t first, uint32_t count) {
+    uint32_t index = static_cast<uint32_t>(nodes.size());
+    nodes.push_back({});
+
+    Rect2d bounds = items[first].aabb;
+    for (uint32_t i = first + 1; i < first + count; ++i)
+        bounds = bounds.Union(items[i].aabb);
+    nodes[index].bounds = bounds;
+
+    if (count <= LeafSize) {
+        nodes[index].offset = first;
+        nodes[index].count = count;
+        return index;
+    }
+
+    // Median split on the longer axis of the item centres
+    bool splitX = bounds.width >= bounds.height;
+    uint32_t half = count / 2;
+    auto begin = items.begin() + first;
+    std::nth_element(begin, begin + half, begin + count, [splitX](const Entry& l, const Entry& r) {
+        return splitX ? (2 * l.aabb.x + l.aabb.width) < (2 * r.aabb.x + r.aabb.width)
+                      : (2 * l.aabb.y + l.aabb.height) < (2 * r.aabb.y + r.aabb.height);
+    });
+
+    BuildRange(first, half);
+    uint32_t right = BuildRange(first + half, count - half);
+    nodes[index].offset = right;
+    nodes[index].count = 0;
+    return index;
+}
+
+void StaticCollisionLayer::Clear() {
+    nodes.clear();
+    items.clear();
+}
+
+void StaticCollisionLayer::QueryRegion(const Rect2d& region, std::vector<uint32_t>& out) const {
+    Query(region, [&out](uint32_t item) { out.push_back(item); });
+}
+
+void StaticCollisionLayer::QueryRay(const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                                    std::vector<uint32_t>& out) const {
+    double tEntry;
+    Traverse(
+        [&](const Rect2d& box) { return RayOverlapsAABB(origin, dir, maxDistance, box, tEntry); },
+        [&](uint32_t item) {
+            if (RayOverlapsAABB(origin, dir, maxDistance, items[item].aabb, tEntry))
+                out.push_back(item);
+        });
+}
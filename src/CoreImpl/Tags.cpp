@@ -0,0 +1,60 @@
+#include "Core/Tags.h"
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const noexcept { return std::hash<std::string_view>()(name); }
+    };
+
+    struct Table {
+        std::mutex mutex;
+        std::deque<std::string> names; // by atom; a deque so names never move
+        std::unordered_map<std::string, TagId, NameHash, std::equal_to<>> atoms;
+
+        Table() {
+            // In BuiltinTag order
+            Add("Player");
+        }
+
+        TagId Add(std::string_view name) {
+            if (names.size() >= Tags::Null)
+                throw std::runtime_error("[Tags] more than " + std::to_string(Tags::Null) + " tags");
+            TagId tag = static_cast<TagId>(names.size());
+            names.emplace_back(name);
+            atoms.emplace(names.back(), tag);
+            return tag;
+        }
+    };
+
+    // Never destroyed, so tags can be looked up during static destruction
+    Table& GetTable() {
+        static Table* table = new Table();
+        return *table;
+    }
+}
+
+TagId Tags::Intern(std::string_view name) {
+    Table& table = GetTable();
+    std::lock_guard lock(table.mutex);
+    auto it = table.atoms.find(name);
+    return it != table.atoms.end() ? it->second : table.Add(name);
+}
+
+TagId Tags::Find(std::string_view name) {
+    Table& table = GetTable();
+    std::lock_guard lock(table.mutex);
+    auto it = table.atoms.find(name);
+    return it != table.atoms.end() ? it->second : Null;
+}
+
+const std::string& Tags::GetName(TagId tag) {
+    Table& table = GetTable();
+    std::lock_guard lock(table.mutex);
+    if (tag >= table.names.size())
+        throw std::out_of_range("[Tags] unknown tag " + std::to_string(tag));
+    return table.names[tag];
+}
@@ -0,0 +1,61 @@
+#include "Core/World/TickScheduler.h"
+
+TickTier TickScheduler::TierOf(uint8_t bucket) {
+    size_t tier = size_t(TickTier::Count) - 1;
+    while (FirstBucket[tier] > bucket) --tier;
+    return TickTier(tier);
+}
+
+void TickScheduler::Add(GameObject* obj, uint32_t slot, double now) {
+    if (slot >= locations.size()) locations.resize(slot + 1);
+    locations[slot].pinned = false;
+    Insert({ obj, slot, now, current }, BucketFor(TickTier::EveryTick, slot));
+}
+
+void TickScheduler::Remove(uint32_t slot) {
+    if (slot >= locations.size() || locations[slot].bucket == NoBucket) return;
+    Erase(slot);
+    locations[slot] = {};
+}
+
+void TickScheduler::SetTier(uint32_t slot, TickTier tier, bool pinned) {
+    if (slot >= locations.size() || locations[slot].bucket == NoBucket || tier == TickTier::Count) return;
+    locations[slot].pinned = pinned;
+    uint8_t bucket = BucketFor(tier, slot);
+    if (bucket == locations[slot].bucket) return;
+    // Keeps lastTick, so the first tick in the new tier covers the time since the last one
+    Insert(Erase(slot), bucket);
+}
+
+TickTier TickScheduler::GetTier(uint32_t slot) const {
+    if (slot >= locations.size() || locations[slot].bucket == NoBucket) return TickTier::EveryTick;
+    return TierOf(locations[slot].bucket);
+}
+
+size_t TickScheduler::GetCount(TickTier tier) const {
+    if (tier == TickTier::Count) return 0;
+    size_t count = 0;
+    for (uint32_t phase = 0; phase < Intervals[size_t(tier)]; ++phase)
+        count += buckets[FirstBucket[size_t(tier)] + phase].size();
+    return count;
+}
+
+void TickScheduler::Insert(const Entry& entry, uint8_t bucket) {
+    Location& location = locations[entry.slot];
+    location.bucket = bucket;
+    location.index = static_cast<uint32_t>(buckets[bucket].size());
+    buckets[bucket].push_back(entry);
+}
+
+TickScheduler::Entry TickScheduler::Erase(uint32_t slot) {
+    Location& location = locations[slot];
+    std::vector<Entry>& bucket = buckets[location.bucket];
+    Entry entry = bucket[location.index];
+    if (location.index + 1 != bucket.size()) {
+        bucket[location.index] = bucket.back();
+        locations[bucket[location.index].slot].index = location.index;
+    }
+    bucket.pop_back();
+    location.bucket = NoBucket;
+    return entry;
+}
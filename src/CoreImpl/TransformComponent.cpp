@@ -8,15 +8,23 @@ TransformComponent::TransformComponent(const Vector2d& pos, const Vector2d& scl,
     : position(pos), scale(scl), rotation(rot) {}
 
 void TransformComponent::SetPosition(const Vector2d& pos) {
-    position = pos;
+    if (bodies) {
+        bodies->SetPosition(body, pos);
+        bodies->Wake(body);
+    }
+    else position = pos;
 }
 
-const Vector2d& TransformComponent::GetPosition() const {
-    return position;
+Vector2d TransformComponent::GetPosition() const {
+    return bodies ? bodies->GetPosition(body) : position;
 }
 
 void TransformComponent::Translate(const Vector2d& delta) {
-    position += delta;
+    if (bodies) {
+        bodies->Translate(body, delta);
+        bodies->Wake(body);
+    }
+    else position += delta;
 }
 
 void TransformComponent::SetRotation(float degrees) {
@@ -45,33 +53,64 @@ void TransformComponent::Scale(const Vector2d& factor) {
 }
 
 void TransformComponent::ResetTransform() {
-    position = {0.0f, 0.0f};
+    SetPosition({0.0f, 0.0f});
     scale = {1.0f, 1.0f};
     rotation = 0.0f;
-    velocity = {0.0f, 0.0f};
-    acceleration = {0.0f, 0.0f};
+    SetVelocity({0.0f, 0.0f});
+    SetAcceleration({0.0f, 0.0f});
 }
 
 void TransformComponent::SetVelocity(const Vector2d& vel) {
-    velocity = vel;
+    if (bodies) {
+        bodies->SetVelocity(body, vel);
+        bodies->Wake(body);
+    }
+    else velocity = vel;
 }
 
-const Vector2d& TransformComponent::GetVelocity() const {
-    return velocity;
+Vector2d TransformComponent::GetVelocity() const {
+    return bodies ? bodies->GetVelocity(body) : velocity;
 }
 
 void TransformComponent::Move(const Vector2d& delta) {
-    position += delta;
+    Translate(delta);
 }
 
 void TransformComponent::Accelerate(const Vector2d& accel) {
-    acceleration = accel;
+    SetAcceleration(accel);
 }
 
-const Vector2d& TransformComponent::GetAcceleration() const {
-    return acceleration;
+Vector2d TransformComponent::GetAcceleration() const {
+    return bodies ? bodies->GetAcceleration(body) : acceleration;
 }
 
 void TransformComponent::SetAcceleration(const Vector2d& accel) {
-    acceleration = accel;
+    if (bodies) {
+        bodies->SetAcceleration(body, accel);
+        bodies->Wake(body);
+    }
+    else acceleration = accel;
+}
+
+void TransformComponent::BindBody(PhysicsBodyStore* store, PhysicsBodyStore::BodyId id) {
+    if (store && store == bodies) {
+        // Same store, the body was just relocated
+        body = id;
+        return;
+    }
+
+    if (bodies) {
+        position = bodies->GetPosition(body);
+        velocity = bodies->GetVelocity(body);
+        acceleration = bodies->GetAcceleration(body);
+    }
+
+    bodies = store;
+    body = id;
+
+    if (bodies) {
+        bodies->SetPosition(body, position);
+        bodies->SetVelocity(body, velocity);
+        bodies->SetAcceleration(body, acceleration);
+    }
 }
\ No newline at end of file
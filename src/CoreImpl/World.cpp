@@ -1,193 +1,818 @@
 #include "Core/World/World.h"
 #include "Core/Objects/Entity.h"
 #include "Core/World/CollisionMatrix.h"
+#include "Core/World/DynamicAABBTree.h"
+#include "Core/World/SpatialHashGrid.h"
 #include "Util/Physics/RectSwept.h"
+#include "Util/Physics/ShapeQueries.h"
+#include "Util/Physics/SweptAABBBatch.h"
+#include <limits>
+
+namespace {
+    const double EPS = 1e-6;
+    const double MIN_STEP = 1e-5; // at least this many seconds when a collision is detected to make progress
+
+    bool PassesFilter(const GameObject* obj, CollisionMatrix::Mask mask, const QueryFilter& filter) {
+        return obj != filter.ignore && (mask & obj->GetCollisionCategoryBits()) != 0;
+    }
+
+    bool PassesFilter(const Hitbox& hb, CollisionMatrix::Mask mask, const QueryFilter& filter) {
+        return (mask & hb.categoryBits) != 0 && (filter.includeTriggers || !hb.isTrigger);
+    }
+
+    // Whether `shape` at pos comes within slop of the trigger volume `zone` at zonePos.
+    // Exact except between two polygons, which are compared by their bounds.
+    bool TouchesTrigger(const HitboxShape& zone, const Vector2d& zonePos, const HitboxShape& shape,
+                        const Vector2d& pos, double slop) {
+        if (zone.GetType() == HitboxShapeType::Circle) {
+            const auto& circle = zone.As<CircleShape>();
+            return ShapeQuery::OverlapsCircle(shape, pos, circle.GetCenter() + zonePos, circle.GetRadius() + slop);
+        }
+        if (zone.GetType() == HitboxShapeType::Polygon) {
+            if (shape.GetType() == HitboxShapeType::Circle) {
+                const auto& circle = shape.As<CircleShape>();
+                return ShapeQuery::OverlapsCircle(zone, zonePos, circle.GetCenter() + pos, circle.GetRadius() + slop);
+            }
+            if (shape.GetType() == HitboxShapeType::Rectangle)
+                return ShapeQuery::OverlapsRect(zone, zonePos, shape.GetLocalBounds().Translated(pos).Expanded(slop));
+        }
+        return ShapeQuery::OverlapsRect(shape, pos, zone.GetLocalBounds().Translated(zonePos).Expanded(slop));
+    }
+
+    // Per-thread candidate scratch, so queries can run concurrently without allocating
+    thread_local std::vector<IBroadphase::ProxyId> queryProxies;
+    thread_local std::vector<uint32_t> queryItems;
+    thread_local RectBatch queryRects;
+    thread_local std::vector<GameObject*> queryRectOwners;
+    thread_local std::vector<uint32_t> queryRectOrder;
+}
 
 void World::Tick(float dt) {
-    // integrate velocities
-    for (auto& obj : objects) {
-        auto phys = obj->GetPhysicalProperties();
-        if (phys && !phys->IsAnchored()) {
-            Vector2d v = obj->GetVelocity();
-            Vector2d a = obj->GetAcceleration();
-            obj->SetVelocity(v + a * dt);
+    SlabAllocator::Stats allocationsBefore = SlabAllocator::GetStats();
+    std::unique_lock queryLock(queryMutex);
+    events.Begin();
+    bodies.SavePreviousPositions();
+
+    if (staticGeometryDirty)
+        RebuildStaticLayer();
+
+    bodies.Integrate(dt);
+    TickSystems(dt);
+
+    if (tickLod.enabled && tickCount % std::max<uint32_t>(tickLod.reassignTicks, 1) == 0)
+        AssignTickTiers();
+    tickTime += dt;
+    // Object ticks may run queries and add or remove objects
+    queryLock.unlock();
+    scheduler.ForEachDue(tickCount, tickTime, [](GameObject* obj, float objectDt) { obj->Tick(objectDt); });
+    queryLock.lock();
+    ++tickCount;
+
+    // Component ticks may have moved anchored geometry
+    if (staticGeometryDirty)
+        RebuildStaticLayer();
+
+    narrowphasePasses = 0;
+    contactCache.BeginTick(physicsSettings.contactExpiryTicks);
+    if (physicsSettings.warmStarting)
+        WarmStartContacts();
+
+    if (physicsSettings.solver == SolverMode::Islands)
+        SolveIslands(dt);
+    else
+        SolveGlobal(dt);
+
+    bodies.UpdateSleep(physicsSettings.sleepVelocity, physicsSettings.sleepAcceleration, physicsSettings.sleepTicks);
+
+    // Leave the acceleration structures matching where things ended up, for queries between ticks
+    UpdateBroadphase(0.0);
+    if (staticGeometryDirty)
+        RebuildStaticLayer();
+
+    UpdateTriggerContacts();
+    queryLock.unlock();
+    // Listeners run here, once the world is consistent again
+    events.Dispatch(*this);
+
+    SlabAllocator::Stats allocationsAfter = SlabAllocator::GetStats();
+    tickAllocations = allocationsAfter.allocations - allocationsBefore.allocations;
+    tickSystemAllocations = allocationsAfter.systemAllocations - allocationsBefore.systemAllocations;
+}
+
+bool World::SweepPair(GameObject* a, GameObject* b, double interval, double& earliest, Contact& contact) const {
+    auto ha = a->GetComponent<HitboxComponent>();
+    auto hb = b->GetComponent<HitboxComponent>();
+    if (!ha || !hb) return false;
+
+    PhysicsBodyStore::BodyId ia = a->GetPhysicsBody(), ib = b->GetPhysicsBody();
+    if (bodies.IsAnchored(ia) && bodies.IsAnchored(ib))
+        return false;
+
+    Vector2d dispA = bodies.GetVelocity(ia) * interval;
+    Vector2d dispB = bodies.GetVelocity(ib) * interval;
+    Vector2d posA = bodies.GetPosition(ia);
+    Vector2d posB = bodies.GetPosition(ib);
+
+    bool found = false;
+    for (const auto& hbA : ha->GetHitboxes()) {
+        for (const auto& hbB : hb->GetHitboxes()) {
+            if (!hbA.CollidesWith(hbB))
+                continue;
+
+            SweepResult res = SweptShapeCollision(
+                hbA.shape, posA, dispA,
+                hbB.shape, posB, dispB,
+                interval
+            );
+
+            if (!res.hit) continue;
+
+            // clamp TOI to [0,1] to avoid floating error causing toi slightly outside
+            res.toi = std::max(0.0, std::min(1.0, res.toi));
+            double impactTimeAbsolute = res.toi * interval;
+
+            // prefer strictly earlier impacts
+            if (impactTimeAbsolute < earliest) {
+                earliest = impactTimeAbsolute;
+                contact = { a, b, &hbA, &hbB, impactTimeAbsolute, res.normal, hbA.isTrigger || hbB.isTrigger };
+                found = true;
+            }
         }
-        obj->Tick(dt);
     }
+    return found;
+}
 
+template <typename PairIndex>
+void World::SweepPairs(size_t begin, size_t end, double interval, PairIndex pairIndex) {
+    pairSweeps.resize(candidatePairs.size());
+
+    auto sweepRange = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            uint32_t index = pairIndex(i);
+            const auto& [a, b] = candidatePairs[index];
+            PairSweep& sweep = pairSweeps[index];
+            double earliest = interval;
+            sweep.hit = SweepPair(a, b, interval, earliest, sweep.contact);
+        }
+    };
+
+    size_t count = end - begin;
+    JobSystem* jobs = GetJobSystem();
+    if (!jobs || count < physicsSettings.parallelPairThreshold) {
+        sweepRange(begin, end);
+        return;
+    }
+
+    // SweepPair only reads object state, so ranges can be swept concurrently
+    jobs->ParallelFor(count, 64, [&](size_t from, size_t to) {
+        sweepRange(begin + from, begin + to);
+    });
+}
+
+void World::ApplyContact(const Contact& contact, double step) {
+    bodies.Wake(contact.a->GetPhysicsBody());
+    bodies.Wake(contact.b->GetPhysicsBody());
+
+    events.RecordCollision(contact.a, contact.b);
+
+    // Triggers currently resolve like solid contacts; handlers decide what else happens.
+    // NOTE: ResolveCollision receives the step just advanced, not the impact time.
+    float impulse = ResolveCollision(contact.a, contact.b, contact.normal, static_cast<float>(step));
+
+    if (physicsSettings.warmStarting && impulse > 0.0f) {
+        auto hitboxIndex = [](const GameObject* obj, const Hitbox* hb) {
+            return static_cast<uint32_t>(hb - obj->GetHitbox()->GetHitboxes().data());
+        };
+        contactCache.Record(contact.a->GetHandle(), contact.b->GetHandle(), hitboxIndex(contact.a, contact.hitboxA),
+                            hitboxIndex(contact.b, contact.hitboxB), contact.normal, impulse);
+    }
+}
+
+void World::WarmStartContacts() {
+    warmContacts.clear();
+
+    for (uint32_t i = 0; i < contactCache.Size(); ++i) {
+        const ContactCache::Entry& entry = contactCache.GetEntries()[i];
+        if (entry.warmImpulse <= 0.0) continue;
+
+        // Entries of objects that left the world resolve to null and wait to expire
+        const ContactCache::Key& key = entry.key;
+        GameObject* objA = Resolve(key.a);
+        GameObject* objB = Resolve(key.b);
+        if (!objA || !objB) continue;
+
+        auto ha = objA->GetHitbox();
+        auto hb = objB->GetHitbox();
+        if (!ha || !hb || key.hitboxA >= ha->GetHitboxes().size() || key.hitboxB >= hb->GetHitboxes().size())
+            continue;
+
+        PhysicsBodyStore::BodyId ia = objA->GetPhysicsBody(), ib = objB->GetPhysicsBody();
+        if ((bodies.IsAnchored(ia) || bodies.IsSleeping(ia)) && (bodies.IsAnchored(ib) || bodies.IsSleeping(ib)))
+            continue;
+
+        // Still touching: the gap between the hitboxes' bounds along the normal is
+        // within slop, and they still overlap across it. A body that slid past the
+        // end of a wall is no longer touching it, however close it is along the normal.
+        double aLo, aHi, bLo, bHi;
+        Rect2d boundsA = ha->GetHitboxes()[key.hitboxA].shape.GetLocalBounds().Translated(bodies.GetPosition(ia));
+        Rect2d boundsB = hb->GetHitboxes()[key.hitboxB].shape.GetLocalBounds().Translated(bodies.GetPosition(ib));
+        ShapeQuery::ProjectRect(boundsA, entry.normal, aLo, aHi);
+        ShapeQuery::ProjectRect(boundsB, entry.normal, bLo, bHi);
+        if (aLo - bHi > physicsSettings.contactSlop) continue;
+        Vector2d tangent(-entry.normal.y, entry.normal.x);
+        ShapeQuery::ProjectRect(boundsA, tangent, aLo, aHi);
+        ShapeQuery::ProjectRect(boundsB, tangent, bLo, bHi);
+        if (aLo - bHi > physicsSettings.contactSlop || bLo - aHi > physicsSettings.contactSlop) continue;
+
+        double invMassSum = bodies.GetInverseMass(ia) + bodies.GetInverseMass(ib);
+        if (invMassSum <= 0.0) continue;
+
+        warmContacts.push_back({ i, objA, objB, ia, ib, entry.normal, invMassSum, 0.0 });
+    }
+
+    auto applyImpulse = [this](const WarmContact& c, double j) {
+        Vector2d impulse = c.normal * j;
+        if (!bodies.IsAnchored(c.a))
+            bodies.SetVelocity(c.a, bodies.GetVelocity(c.a) + impulse * bodies.GetInverseMass(c.a));
+        if (!bodies.IsAnchored(c.b))
+            bodies.SetVelocity(c.b, bodies.GetVelocity(c.b) - impulse * bodies.GetInverseMass(c.b));
+    };
+
+    // Start from last tick's impulses, then refine them with sequential impulses.
+    // Each contact's total stays non-negative: contacts can push, never pull.
+    for (auto& c : warmContacts) {
+        c.impulse = contactCache.GetEntries()[c.entry].warmImpulse;
+        applyImpulse(c, c.impulse);
+    }
+
+    for (uint32_t iteration = 0; iteration < physicsSettings.contactIterations; ++iteration) {
+        for (auto& c : warmContacts) {
+            double relN = (bodies.GetVelocity(c.a) - bodies.GetVelocity(c.b)).Dot(c.normal);
+            double total = std::max(0.0, c.impulse - relN / c.invMassSum);
+            applyImpulse(c, total - c.impulse);
+            c.impulse = total;
+        }
+    }
+
+    for (const auto& c : warmContacts) {
+        if (c.impulse <= 0.0) continue;
+
+        const ContactCache::Key& key = contactCache.GetEntries()[c.entry].key;
+        contactCache.Record(key.a, key.b, key.hitboxA, key.hitboxB, c.normal, c.impulse);
+        bodies.Wake(c.a);
+        bodies.Wake(c.b);
+        events.RecordCollision(c.objectA, c.objectB);
+    }
+}
+
+// Finds the earliest contact across the whole world, advances every body to it,
+// resolves it and rescans until the tick is used up.
+void World::SolveGlobal(double dt) {
     double remaining = dt;
-    const double EPS = 1e-6;
-    const double MIN_STEP = 1e-5; // at least this many seconds when a collision is detected to make progress
 
     while (remaining > EPS) {
         double earliest = remaining;
-        GameObject* hitObjA = nullptr;
-        GameObject* hitObjB = nullptr;
-        const Hitbox* hitboxA = nullptr;
-        const Hitbox* hitboxB = nullptr;
-        Vector2d hitNormal{0,0};
-        bool hitIsTrigger = false;
-
-        // find earliest collision in the remaining interval
-        for (size_t i = 0; i < objects.size(); ++i) {
-            for (size_t j = i + 1; j < objects.size(); ++j) {
-                auto* a = objects[i].get();
-                auto* b = objects[j].get();
-
-                auto ha = a->GetComponent<HitboxComponent>();
-                auto hb = b->GetComponent<HitboxComponent>();
-                if (!ha || !hb) continue;
-
-                auto ta = a->GetComponent<TransformComponent>();
-                auto tb = b->GetComponent<TransformComponent>();
-                if (!ta || !tb) continue;
-
-                auto pa = a->GetPhysicalProperties();
-                auto pb = b->GetPhysicalProperties();
-                if ((pa && pa->IsAnchored()) && (pb && pb->IsAnchored()))
-                    continue;
-
-                Vector2d va = a->GetVelocity();
-                Vector2d vb = b->GetVelocity();
-
-                for (const auto& hbA : ha->GetHitboxes()) {
-                    for (const auto& hbB : hb->GetHitboxes()) {
-                        if (CollisionMatrix::ShouldCollide(hbA.group, hbB.group))
-                            continue;
-
-                        Vector2d dispA = va * remaining;
-                        Vector2d dispB = vb * remaining;
-                        Vector2d posA = ta->GetPosition();
-                        Vector2d posB = tb->GetPosition();
-
-                        SweepResult res = SweptShapeCollision(
-                            *hbA.shape, posA, dispA,
-                            *hbB.shape, posB, dispB,
-                            remaining
-                        );
-
-                        if (!res.hit) continue;
-
-                        // clamp TOI to [0,1] to avoid floating error causing toi slightly outside
-                        res.toi = std::max(0.0, std::min(1.0, res.toi));
-                        res.isTrigger = (hbA.isTrigger || hbB.isTrigger);
-
-                        double impactTimeAbsolute = res.toi * remaining;
-
-                        // prefer strictly earlier impacts
-                        if (impactTimeAbsolute < earliest) {
-                            earliest = impactTimeAbsolute;
-                            hitObjA = a;
-                            hitObjB = b;
-                            hitboxA = &hbA;
-                            hitboxB = &hbB;
-                            hitNormal = res.normal;
-                            hitIsTrigger = res.isTrigger;
-                        }
-                    }
-                }
+        Contact contact;
+        bool hit = false;
+
+        // find earliest collision in the remaining interval, among broadphase candidates only
+        GatherCandidatePairs(remaining);
+        SweepPairs(0, candidatePairs.size(), remaining, [](size_t i) { return static_cast<uint32_t>(i); });
+        ++narrowphasePasses;
+
+        size_t chosen = 0;
+        for (size_t i = 0; i < pairSweeps.size(); ++i) {
+            const PairSweep& sweep = pairSweeps[i];
+            if (sweep.hit && sweep.contact.time < earliest) {
+                earliest = sweep.contact.time;
+                contact = sweep.contact;
+                chosen = i;
+                hit = true;
             }
         }
 
-        // If we found a collision at 'earliest' (could be 0)
-        if (hitObjA && hitObjB && hitboxA && hitboxB) {
-            // If earliest is extremely small (including 0), advance by a tiny step to avoid stalling.
-            double step = earliest;
-            if (step < MIN_STEP) step = std::min(MIN_STEP, remaining);
+        if (!hit) {
+            // No collision detected in 'remaining' interval -> move full remaining and finish
+            AdvanceBodies(remaining);
+            break;
+        }
+
+        // If earliest is extremely small (including 0), advance by a tiny step to avoid stalling.
+        double step = earliest;
+        if (step < MIN_STEP) step = std::min(MIN_STEP, remaining);
+
+        AdvanceBodies(step);
+
+        remaining -= step;
+        ApplyContact(contact, step);
+
+        // Contacts the step reached are resolved with it, earliest first. Stepping past a
+        // simultaneous contact would leave its bodies overlapping, which sweeps do not report.
+        for (size_t i = 0; i < pairSweeps.size(); ++i) {
+            if (i != chosen && pairSweeps[i].hit && pairSweeps[i].contact.time <= step)
+                ApplyContact(pairSweeps[i].contact, step);
+        }
+    }
+}
+
+// Splits the tick's candidate pairs into islands of dynamic bodies that can
+// reach each other, then steps each island on its own clock. Anchored bodies
+// never join islands together, and bodies with no candidates move in one step.
+void World::SolveIslands(double dt) {
+    GatherCandidatePairs(dt);
+
+    // Every dynamic body with hitboxes has a proxy, so proxy ids double as island nodes
+    IBroadphase::ProxyId maxProxy = IBroadphase::NullProxy;
+    for (const auto& [a, b] : candidatePairs)
+        maxProxy = std::max({ maxProxy, a->GetBroadphaseProxy(), b->GetBroadphaseProxy() });
 
-            // Move all non-anchored objects forward by 'step'
-            for (auto& obj : objects) {
-                if (auto phys = obj->GetPhysicalProperties(); !phys || !phys->IsAnchored()) {
-                    obj->Move(obj->GetVelocity() * step);
+    islandParent.resize(maxProxy + 1);
+    for (IBroadphase::ProxyId i = 0; i <= maxProxy; ++i) islandParent[i] = i;
+
+    auto findRoot = [this](IBroadphase::ProxyId i) {
+        while (islandParent[i] != i) {
+            islandParent[i] = islandParent[islandParent[i]];
+            i = islandParent[i];
+        }
+        return i;
+    };
+
+    for (const auto& [a, b] : candidatePairs) {
+        if (IsDynamic(a) && IsDynamic(b)) {
+            IBroadphase::ProxyId ra = findRoot(a->GetBroadphaseProxy()), rb = findRoot(b->GetBroadphaseProxy());
+            if (ra != rb) islandParent[std::max(ra, rb)] = std::min(ra, rb);
+        }
+    }
+
+    // Group pairs by the island of their dynamic member, keeping candidate order inside each island
+    islandPairs.clear();
+    for (uint32_t i = 0; i < candidatePairs.size(); ++i) {
+        auto [a, b] = candidatePairs[i];
+        GameObject* body = IsDynamic(a) ? a : b;
+        islandPairs.emplace_back(findRoot(body->GetBroadphaseProxy()), i);
+    }
+    std::stable_sort(islandPairs.begin(), islandPairs.end(),
+        [](const auto& l, const auto& r) { return l.first < r.first; });
+
+    // Every island's first pass sweeps over the full tick from the same start
+    // state, so those sweeps are done up front in one batch
+    SweepPairs(0, candidatePairs.size(), dt, [](size_t i) { return static_cast<uint32_t>(i); });
+    ++narrowphasePasses;
+
+    inIsland.assign(maxProxy + 1, false);
+
+    for (size_t begin = 0; begin < islandPairs.size();) {
+        size_t end = begin;
+        while (end < islandPairs.size() && islandPairs[end].first == islandPairs[begin].first) ++end;
+
+        islandBodies.clear();
+        for (size_t i = begin; i < end; ++i) {
+            auto [a, b] = candidatePairs[islandPairs[i].second];
+            for (GameObject* obj : { a, b }) {
+                int proxy = obj->GetBroadphaseProxy();
+                if (IsDynamic(obj) && !inIsland[proxy]) {
+                    inIsland[proxy] = true;
+                    islandBodies.push_back(proxy);
                 }
             }
+        }
+        std::sort(islandBodies.begin(), islandBodies.end());
+
+        SolveIsland(begin, end, dt);
+        begin = end;
+    }
+
+    // Bodies that cannot touch anything this tick move in a single step
+    for (PhysicsBodyStore::BodyId id = 0; id < bodies.Size(); ++id) {
+        if (bodies.IsAnchored(id)) continue;
+
+        int proxy = bodies.GetObject(id)->GetBroadphaseProxy();
+        if (proxy != IBroadphase::NullProxy && proxy <= maxProxy && inIsland[proxy]) continue;
+
+        AdvanceBody(id, dt);
+    }
+}
 
-            remaining -= step;
+// Earliest-contact loop restricted to one island: islandPairs[begin, end) and islandBodies.
+// Resolved velocities are a blend of the colliding bodies' velocities, so the
+// island stays (approximately) inside the swept bounds it was built from.
+void World::SolveIsland(size_t begin, size_t end, double dt) {
+    double remaining = dt;
+    bool presweep = true; // pairSweeps already holds the first pass (see SolveIslands)
 
-            if (hitObjA) hitObjA->OnCollision(hitObjB);
-            if (hitObjB) hitObjB->OnCollision(hitObjA);
+    while (remaining > EPS) {
+        double earliest = remaining;
+        Contact contact;
+        bool hit = false;
 
-            // If this collision is a trigger, call trigger handlers but do NOT do physical resolve.
-            if (hitIsTrigger) {
-                // continue to next iteration (we already advanced by 'step' so will make progress)
-                // continue;
+        if (!presweep) {
+            SweepPairs(begin, end, remaining, [this](size_t i) { return islandPairs[i].second; });
+            ++narrowphasePasses;
+        }
+        presweep = false;
+
+        size_t chosen = begin;
+        for (size_t i = begin; i < end; ++i) {
+            const PairSweep& sweep = pairSweeps[islandPairs[i].second];
+            if (sweep.hit && sweep.contact.time < earliest) {
+                earliest = sweep.contact.time;
+                contact = sweep.contact;
+                chosen = i;
+                hit = true;
             }
+        }
+
+        double step = remaining;
+        if (hit) {
+            step = earliest;
+            if (step < MIN_STEP) step = std::min(MIN_STEP, remaining);
+        }
+
+        for (auto proxy : islandBodies)
+            AdvanceBody(broadphase->GetObject(proxy)->GetPhysicsBody(), step);
 
-            // Non-trigger: resolve physically.
-            // NOTE: ResolveCollision should expect the time step you just advanced (step),
-            // or you can pass the impact time (earliest) depending on ResolveCollision semantics.
-            ResolveCollision(hitObjA, hitObjB, hitNormal, static_cast<float>(step));
+        if (!hit) break;
 
-            // after resolving, continue the loop to find further collisions within remaining time
+        remaining -= step;
+        ApplyContact(contact, step);
+
+        // As in SolveGlobal, every contact the step reached is resolved now
+        for (size_t i = begin; i < end; ++i) {
+            const PairSweep& sweep = pairSweeps[islandPairs[i].second];
+            if (i != chosen && sweep.hit && sweep.contact.time <= step)
+                ApplyContact(sweep.contact, step);
+        }
+    }
+}
+
+void World::UpdateBroadphase(double horizon) {
+    for (auto& obj : objects) {
+        PhysicsBodyStore::BodyId id = obj->GetPhysicsBody();
+        int proxy = obj->GetBroadphaseProxy();
+
+        // Sleeping bodies have not moved (or changed shape) since their last refit
+        if (bodies.IsSleeping(id) && proxy != IBroadphase::NullProxy)
+            continue;
+
+        // Anchored geometry lives in the static layer instead
+        auto hitbox = obj->GetHitbox();
+        if (bodies.IsAnchored(id) || !hitbox || hitbox->GetHitboxes().empty()) {
+            RemoveFromBroadphase(obj.get());
             continue;
         }
 
-        // No collision detected in 'remaining' interval -> move full remaining and finish
-        for (auto& obj : objects) {
-            if (auto phys = obj->GetPhysicalProperties(); !phys || !phys->IsAnchored()) {
-                obj->Move(obj->GetVelocity() * remaining);
+        // Sweep the bounds along the path the object can travel this pass
+        bodies.Sweep(id, bodies.GetVelocity(id) * horizon);
+        const Rect2d& aabb = bodies.GetSweptBounds(id);
+
+        if (proxy == IBroadphase::NullProxy)
+            obj->SetBroadphaseProxy(broadphase->CreateProxy(aabb, obj.get()));
+        else
+            broadphase->MoveProxy(proxy, aabb);
+    }
+}
+
+// Dynamic-dynamic pairs come from the broadphase, dynamic-static pairs from
+// querying the static layer with each body's swept bounds. Anchored pairs are
+// never enumerated.
+void World::GatherCandidatePairs(double horizon) {
+    UpdateBroadphase(horizon);
+
+    proxyPairs.clear();
+    broadphase->QueryPairs(proxyPairs);
+
+    candidatePairs.clear();
+    for (const auto& [proxyA, proxyB] : proxyPairs) {
+        GameObject* a = broadphase->GetObject(proxyA);
+        GameObject* b = broadphase->GetObject(proxyB);
+        if (IsSleeping(a) && IsSleeping(b)) continue;
+        if (!a->CanCollideWith(*b)) continue;
+        candidatePairs.emplace_back(a, b);
+    }
+
+    if (staticLayer.Size() == 0) return;
+
+    for (auto& obj : objects) {
+        int proxy = obj->GetBroadphaseProxy();
+        if (proxy == IBroadphase::NullProxy || IsSleeping(obj.get())) continue;
+
+        // The exact swept bounds, not the proxy's fattened box
+        GameObject* body = obj.get();
+        staticLayer.Query(bodies.GetSweptBounds(body->GetPhysicsBody()), [this, body](uint32_t item) {
+            GameObject* other = staticLayer.GetObject(item);
+            if (body->CanCollideWith(*other))
+                candidatePairs.emplace_back(body, other);
+        });
+    }
+}
+
+void World::AdvanceBody(PhysicsBodyStore::BodyId id, double step) {
+    if (bodies.IsSleeping(id)) return;
+
+    Vector2d delta = bodies.GetVelocity(id) * step;
+    bodies.Translate(id, delta);
+    if (delta.LengthSquared() != 0)
+        RecordMoved(bodies.GetObject(id));
+}
+
+void World::AdvanceBodies(double step) {
+    bodies.Advance(step, [this](PhysicsBodyStore::BodyId id) {
+        RecordMoved(bodies.GetObject(id));
+    });
+}
+
+template <typename Fn>
+void World::ForEachQueryCandidate(const Rect2d& region, Fn&& fn) const {
+    queryProxies.clear();
+    broadphase->QueryRegion(region, queryProxies);
+    for (auto proxy : queryProxies)
+        fn(broadphase->GetObject(proxy));
+
+    staticLayer.Query(region, [this, &fn](uint32_t item) {
+        fn(staticLayer.GetObject(item));
+    });
+}
+
+bool World::Raycast(const Vector2d& origin, const Vector2d& direction, double maxDistance,
+                    RaycastHit& hit, const QueryFilter& filter) const {
+    std::shared_lock lock(queryMutex);
+    return CastRay(origin, direction, maxDistance, hit, filter);
+}
+
+bool World::CastRay(const Vector2d& origin, const Vector2d& direction, double maxDistance,
+                    RaycastHit& hit, const QueryFilter& filter) const {
+    hit = RaycastHit{};
+    double length = direction.Length();
+    if (length == 0.0 || maxDistance < 0.0) return false;
+
+    Vector2d dir = direction / length;
+    CollisionMatrix::Mask mask = CollisionMatrix::GetMask(filter.group);
+    double nearest = maxDistance;
+
+    auto test = [&](GameObject* obj) {
+        if (!PassesFilter(obj, mask, filter)) return;
+
+        Vector2d pos = bodies.GetPosition(obj->GetPhysicsBody());
+        for (const auto& hb : obj->GetHitbox()->GetHitboxes()) {
+            if (!PassesFilter(hb, mask, filter)) continue;
+
+            double t;
+            Vector2d normal;
+            if (!ShapeQuery::Raycast(hb.shape, pos, origin, dir, nearest, t, normal)) continue;
+            if (hit.object && t >= nearest) continue;
+
+            nearest = t;
+            hit = { obj, origin + dir * t, t, normal };
+        }
+    };
+
+    queryProxies.clear();
+    broadphase->QueryRay(origin, dir, maxDistance, queryProxies);
+    for (auto proxy : queryProxies)
+        test(broadphase->GetObject(proxy));
+
+    queryItems.clear();
+    staticLayer.QueryRay(origin, dir, maxDistance, queryItems);
+    for (auto item : queryItems)
+        test(staticLayer.GetObject(item));
+
+    return hit.object != nullptr;
+}
+
+size_t World::RaycastBatch(const std::vector<Ray>& rays, std::vector<RaycastHit>& hits,
+                           const QueryFilter& filter) const {
+    hits.resize(rays.size());
+
+    std::shared_lock lock(queryMutex);
+    size_t count = 0;
+    for (size_t i = 0; i < rays.size(); ++i)
+        count += CastRay(rays[i].origin, rays[i].direction, rays[i].maxDistance, hits[i], filter);
+    return count;
+}
+
+bool World::ShapeCast(const HitboxShape& shape, const Vector2d& origin, const Vector2d& displacement,
+                      RaycastHit& hit, const QueryFilter& filter) const {
+    std::shared_lock lock(queryMutex);
+    hit = RaycastHit{};
+    CollisionMatrix::Mask mask = CollisionMatrix::GetMask(filter.group);
+
+    Rect2d start = shape.GetLocalBounds().Translated(origin);
+    Rect2d region = start.Union(start.Translated(displacement));
+    double earliest = 1.0;
+
+    // A rectangle cast defers its rectangle targets to one batched sweep; `order`
+    // numbers every tested hitbox so ties still go to the first one visited
+    const bool rectCast = shape.GetType() == HitboxShapeType::Rectangle;
+    queryRects.Clear();
+    queryRectOwners.clear();
+    queryRectOrder.clear();
+    uint32_t order = 0, hitOrder = 0;
+
+    ForEachQueryCandidate(region, [&](GameObject* obj) {
+        if (!PassesFilter(obj, mask, filter)) return;
+
+        Vector2d pos = bodies.GetPosition(obj->GetPhysicsBody());
+        for (const auto& hb : obj->GetHitbox()->GetHitboxes()) {
+            if (!PassesFilter(hb, mask, filter)) continue;
+            uint32_t current = order++;
+
+            if (rectCast && hb.shape.GetType() == HitboxShapeType::Rectangle) {
+                queryRects.Push(hb.shape.As<RectShape>().GetBounds().Translated(pos));
+                queryRectOwners.push_back(obj);
+                queryRectOrder.push_back(current);
+                continue;
             }
+
+            SweepResult res = SweptShapeCollision(shape, origin, displacement, hb.shape, pos, Vector2d(), 1.0);
+            if (!res.hit) continue;
+
+            double toi = std::max(0.0, std::min(1.0, res.toi));
+            if (hit.object && toi >= earliest) continue;
+
+            earliest = toi;
+            hitOrder = current;
+            hit = { obj, origin + displacement * toi, displacement.Length() * toi, res.normal };
         }
+    });
+
+    if (!queryRects.Empty()) {
+        Rect2d rect = shape.As<RectShape>().GetBounds().Translated(origin);
+        BatchSweepResult res = SweptAABBBatch(rect, displacement, queryRects);
 
-        remaining = 0.0;
-        break;
-    } // end while
+        if (res.hit) {
+            double toi = std::max(0.0, std::min(1.0, res.toi));
+            if (!hit.object || toi < earliest || (toi == earliest && queryRectOrder[res.index] < hitOrder))
+                hit = { queryRectOwners[res.index], origin + displacement * toi, displacement.Length() * toi,
+                        res.GetNormal() };
+        }
+    }
+
+    return hit.object != nullptr;
+}
+
+size_t World::OverlapAABB(const Rect2d& region, std::vector<GameObject*>& out, const QueryFilter& filter) const {
+    std::shared_lock lock(queryMutex);
+    CollisionMatrix::Mask mask = CollisionMatrix::GetMask(filter.group);
+    size_t first = out.size();
+
+    ForEachQueryCandidate(region, [&](GameObject* obj) {
+        if (!PassesFilter(obj, mask, filter)) return;
+
+        // Broadphase boxes are swept or fattened; the cached bounds reject most misses before any shape is read
+        PhysicsBodyStore::BodyId id = obj->GetPhysicsBody();
+        if (!bodies.GetBounds(id).Intersects(region)) return;
+
+        Vector2d pos = bodies.GetPosition(id);
+        for (const auto& hb : obj->GetHitbox()->GetHitboxes()) {
+            if (PassesFilter(hb, mask, filter) && ShapeQuery::OverlapsRect(hb.shape, pos, region)) {
+                out.push_back(obj);
+                return;
+            }
+        }
+    });
+
+    return out.size() - first;
 }
-void World::ResolveCollision(GameObject* a, GameObject* b, const Vector2d& n, float dt) {
-    auto pa = a->GetPhysicalProperties();
-    auto pb = b->GetPhysicalProperties();
 
-    bool anchoredA = pa && pa->IsAnchored();
-    bool anchoredB = pb && pb->IsAnchored();
+size_t World::OverlapCircle(const Vector2d& center, double radius, std::vector<GameObject*>& out,
+                            const QueryFilter& filter) const {
+    std::shared_lock lock(queryMutex);
+    CollisionMatrix::Mask mask = CollisionMatrix::GetMask(filter.group);
+    size_t first = out.size();
+    Rect2d region{ center.x - radius, center.y - radius, 2.0 * radius, 2.0 * radius };
 
-    float ma = (pa && !anchoredA) ? pa->GetMass() : 0.0f;
-    float mb = (pb && !anchoredB) ? pb->GetMass() : 0.0f;
-    float invMa = (ma > 0.0f) ? 1.0f / ma : 0.0f;
-    float invMb = (mb > 0.0f) ? 1.0f / mb : 0.0f;
+    ForEachQueryCandidate(region, [&](GameObject* obj) {
+        if (!PassesFilter(obj, mask, filter)) return;
+
+        // As in OverlapAABB, against the circle's bounding square
+        PhysicsBodyStore::BodyId id = obj->GetPhysicsBody();
+        if (!bodies.GetBounds(id).Intersects(region)) return;
+
+        Vector2d pos = bodies.GetPosition(id);
+        for (const auto& hb : obj->GetHitbox()->GetHitboxes()) {
+            if (PassesFilter(hb, mask, filter) && ShapeQuery::OverlapsCircle(hb.shape, pos, center, radius)) {
+                out.push_back(obj);
+                return;
+            }
+        }
+    });
+
+    return out.size() - first;
+}
+
+void World::RemoveFromBroadphase(GameObject* obj) {
+    int proxy = obj->GetBroadphaseProxy();
+    if (proxy == IBroadphase::NullProxy) return;
+
+    broadphase->DestroyProxy(proxy);
+    obj->SetBroadphaseProxy(IBroadphase::NullProxy);
+}
+
+void World::RebuildStaticLayer() {
+    staticEntries.clear();
+    for (auto& obj : objects) {
+        if (IsDynamic(obj.get())) continue;
+
+        auto hitbox = obj->GetHitbox();
+        if (!hitbox || hitbox->GetHitboxes().empty()) continue;
+
+        staticEntries.push_back({ bodies.GetBounds(obj->GetPhysicsBody()), obj.get() });
+    }
+
+    staticLayer.Build(staticEntries);
+    staticGeometryDirty = false;
+}
+
+std::unique_ptr<IBroadphase> World::CreateBroadphase(const PhysicsSettings& settings) {
+    switch (settings.broadphase) {
+        case BroadphaseType::AABBTree:
+            return std::make_unique<DynamicAABBTree>(settings.aabbTreeMargin);
+        case BroadphaseType::SpatialHash:
+        default:
+            return std::make_unique<SpatialHashGrid>(settings.broadphaseCellSize);
+    }
+}
+
+void World::SetJobSystem(JobSystem* jobs) {
+    sharedJobs = jobs;
+    if (sharedJobs) ownedJobs.reset();
+    else if (physicsSettings.narrowphaseThreads > 0 && !ownedJobs)
+        ownedJobs = std::make_unique<JobSystem>(physicsSettings.narrowphaseThreads);
+}
+
+void World::SetPhysicsSettings(const PhysicsSettings& settings) {
+    std::unique_lock lock(queryMutex);
+    if (settings.narrowphaseThreads != physicsSettings.narrowphaseThreads) {
+        ownedJobs = settings.narrowphaseThreads > 0 && !sharedJobs
+            ? std::make_unique<JobSystem>(settings.narrowphaseThreads)
+            : nullptr;
+    }
+
+    bool rebuild = settings.broadphase != physicsSettings.broadphase ||
+                   settings.broadphaseCellSize != physicsSettings.broadphaseCellSize ||
+                   settings.aabbTreeMargin != physicsSettings.aabbTreeMargin;
+    physicsSettings = settings;
+    if (!rebuild) return;
+
+    // Proxies are re-created lazily on the next tick
+    broadphase = CreateBroadphase(physicsSettings);
+    for (auto& obj : objects)
+        obj->SetBroadphaseProxy(IBroadphase::NullProxy);
+}
+
+float World::ResolveCollision(GameObject* a, GameObject* b, const Vector2d& n, float dt) {
+    PhysicsBodyStore::BodyId ia = a->GetPhysicsBody(), ib = b->GetPhysicsBody();
+
+    bool anchoredA = bodies.IsAnchored(ia);
+    bool anchoredB = bodies.IsAnchored(ib);
+
+    float invMa = bodies.GetInverseMass(ia);
+    float invMb = bodies.GetInverseMass(ib);
 
     if (invMa == 0.0f && invMb == 0.0f)
-        return; // both static
+        return 0.0f; // both static
 
-    Vector2d va = a->GetVelocity();
-    Vector2d vb = b->GetVelocity();
+    Vector2d va = bodies.GetVelocity(ia);
+    Vector2d vb = bodies.GetVelocity(ib);
     Vector2d relV = va - vb;
 
     float relN = relV.Dot(n);
     if (relN >= 0.0f)
-        return; // moving apart
+        return 0.0f; // moving apart
 
     const float restitution = 0.0f; // no bounce for top-down
     float invMassSum = invMa + invMb;
     if (invMassSum <= 0.0f)
-        return;
+        return 0.0f;
 
     // --- NORMAL IMPULSE (cancel penetration velocity) ---
     float j = (-(1.0f + restitution) * relN) / invMassSum;
     Vector2d impulse = j * n;
 
     if (!anchoredA)
-        a->SetVelocity(va + impulse * invMa);
+        bodies.SetVelocity(ia, va + impulse * invMa);
     if (!anchoredB)
-        b->SetVelocity(vb - impulse * invMb);
+        bodies.SetVelocity(ib, vb - impulse * invMb);
 
     // --- DAMP NORMAL ACCELERATION (stop continuous pushing) ---
-    if (!anchoredA && pa) {
-        Vector2d accA = a->GetAcceleration();
+    if (!anchoredA) {
+        Vector2d accA = bodies.GetAcceleration(ia);
         float accN = accA.Dot(n);
         if (accN < 0.0f) // pushing into collision
             accA -= accN * n; // remove normal component
-        a->SetAcceleration(accA);
+        bodies.SetAcceleration(ia, accA);
     }
 
-    if (!anchoredB && pb) {
-        Vector2d accB = b->GetAcceleration();
+    if (!anchoredB) {
+        Vector2d accB = bodies.GetAcceleration(ib);
         float accN = accB.Dot(-n); // opposite normal for B
         if (accN < 0.0f)
             accB -= accN * (-n);
-        b->SetAcceleration(accB);
+        bodies.SetAcceleration(ib, accB);
     }
 
     // --- SEPARATION BIAS (prevent re-collision jitter) ---
+    // Only fresh contacts get this; cached ones are held by warm starting instead
     const float separationBias = 0.001f;
     if (!anchoredA)
         a->Move(n * (separationBias * invMa / invMassSum));
@@ -197,35 +822,157 @@ void World::ResolveCollision(GameObject* a, GameObject* b, const Vector2d& n, fl
     // --- OPTIONAL: later 3D physics or rolling friction ---
     // You could add tangential friction impulses here if you ever
     // extend to 3D dynamics. For now, keep this commented out.
+
+    return j;
 }
 
 
+void World::UpdateTriggerContacts() {
+    const double slop = physicsSettings.contactSlop;
+    for (auto& obj : objects) {
+        GameObject* trigger = obj.get();
+        if (!trigger->HasTriggers()) continue;
+
+        Vector2d pos = bodies.GetPosition(trigger->GetPhysicsBody());
+        for (const auto& zone : trigger->GetHitbox()->GetHitboxes()) {
+            if (!zone.isTrigger) continue;
+
+            Rect2d region = zone.shape.GetLocalBounds().Translated(pos).Expanded(slop);
+            ForEachQueryCandidate(region, [&](GameObject* other) {
+                if (other == trigger || !trigger->CanCollideWith(*other)) return;
+                PhysicsBodyStore::BodyId id = other->GetPhysicsBody();
+                if (!bodies.GetBounds(id).Intersects(region)) return;
+
+                Vector2d otherPos = bodies.GetPosition(id);
+                for (const auto& hb : other->GetHitbox()->GetHitboxes()) {
+                    if (TouchesTrigger(zone.shape, pos, hb.shape, otherPos, slop)) {
+                        events.RecordTriggerContact(trigger, other);
+                        return;
+                    }
+                }
+            });
+        }
+    }
+}
+
+void World::BindSystemComponents(GameObject* obj) {
+    if (auto health = obj->GetComponent<HealthComponent>(); health && !health->IsStored())
+        healthStore.Add(health);
+}
+
+void World::UnbindSystemComponents(GameObject* obj) {
+    if (auto health = obj->GetComponent<HealthComponent>(); health && health->IsStored())
+        healthStore.Remove(health->GetStoreSlot());
+}
+
+void World::OnObjectComponentSet(GameObject* obj, ComponentTypeId id) {
+    if (id == ComponentTypes::IdOf<HealthComponent>()) BindSystemComponents(obj);
+}
+
+void World::TickSystems(float dt) {
+    for (HealthComponent::State& health : healthStore.GetValues()) {
+        if (health.enabled) HealthComponent::Regenerate(health, dt);
+    }
+}
+
+void World::SetTickLodSettings(const TickLodSettings& settings) {
+    if (!(settings.every2ndDistance <= settings.every8thDistance && settings.every8thDistance <= settings.dormantDistance))
+        throw std::invalid_argument("[World] tick LOD distances must not decrease from tier to tier");
+    tickLod = settings;
+}
+
+void World::AssignTickTiers() {
+    lodCenters.clear();
+    for (const auto& player : players) {
+        PlayerEntity* entity = player->GetPlayerEntity();
+        if (Contains(entity)) lodCenters.push_back(entity->GetPosition());
+    }
+    // Nothing to measure from: leave everything where it is
+    if (lodCenters.empty()) return;
+
+    const double every2nd = tickLod.every2ndDistance * tickLod.every2ndDistance;
+    const double every8th = tickLod.every8thDistance * tickLod.every8thDistance;
+    const double dormant = tickLod.dormantDistance * tickLod.dormantDistance;
+    for (auto& obj : objects) {
+        uint32_t slot = obj->GetHandle().index;
+        if (scheduler.IsPinned(slot)) continue;
+
+        Vector2d position = obj->GetPosition();
+        double nearest = std::numeric_limits<double>::infinity();
+        for (const Vector2d& center : lodCenters)
+            nearest = std::min(nearest, (position - center).LengthSquared());
+
+        TickTier tier = nearest < every2nd ? TickTier::EveryTick
+                      : nearest < every8th ? TickTier::Every2nd
+                      : nearest < dormant ? TickTier::Every8th
+                      : TickTier::Dormant;
+        scheduler.SetTier(slot, tier, false);
+    }
+}
+
 void World::ProcessDestroyQueue() {
     if (destroyQueue.empty()) return;
+    std::unique_lock lock(queryMutex);
 
-    objects.erase(std::remove_if(objects.begin(), objects.end(),
-        [this](const std::unique_ptr<GameObject>& obj) {
-            return obj->ShouldDestroy() &&
-                   std::find(destroyQueue.begin(), destroyQueue.end(), obj.get()) != destroyQueue.end();
-        }),
-        objects.end());
+    for (GameObject* obj : destroyQueue) {
+        if (!obj->ShouldDestroy() || !Contains(obj)) continue;
+
+        RemoveFromBroadphase(obj);
+        if (obj->IsAnchored()) staticGeometryDirty = true;
+        bodies.Remove(obj->GetPhysicsBody());
+        UnbindSystemComponents(obj);
+        DetachObject(handleSlots[obj->GetHandle().index].object);
+    }
 
     destroyQueue.clear();
+
+    // Never leave the static layer pointing at freed objects
+    if (staticGeometryDirty) RebuildStaticLayer();
 }
 
 void World::RemoveObject(const GameObject* obj) {
-    if (!obj) return;
+    ReleaseObject(obj);
+}
 
-    objects.erase(std::remove_if(objects.begin(), objects.end(),
-        [obj](const std::unique_ptr<GameObject>& ptr) {
-            if (ptr.get() == obj) {
-                ptr->SetWorld(nullptr);
-                return true;
-            }
-            return false;
-        }), objects.end());
+std::unique_ptr<GameObject> World::ReleaseObject(const GameObject* obj) {
+    std::unique_lock lock(queryMutex);
+    if (!Contains(obj)) return nullptr;
+
+    GameObject* raw = const_cast<GameObject*>(obj);
+    RemoveFromBroadphase(raw);
+    if (raw->IsAnchored()) staticGeometryDirty = true;
+    bodies.Remove(raw->GetPhysicsBody());
+    UnbindSystemComponents(raw);
+
+    std::unique_ptr<GameObject> released = DetachObject(handleSlots[raw->GetHandle().index].object);
+    released->SetWorld(nullptr);
+
+    if (staticGeometryDirty) RebuildStaticLayer();
 
     destroyQueue.erase(std::remove(destroyQueue.begin(), destroyQueue.end(), obj), destroyQueue.end());
+    return released;
+}
+
+std::unique_ptr<GameObject> World::DetachObject(uint32_t index) {
+    std::unique_ptr<GameObject> obj = std::move(objects[index]);
+    if (index + 1 != objects.size()) {
+        objects[index] = std::move(objects.back());
+        handleSlots[objects[index]->GetHandle().index].object = index;
+    }
+    objects.pop_back();
+
+    ObjectHandle handle = obj->GetHandle();
+    scheduler.Remove(handle.index);
+    for (TagId tag : obj->GetTags()) UnindexTag(obj.get(), tag);
+    auto it = uuidIndex.find(obj->GetUUID());
+    if (it != uuidIndex.end() && it->second == handle.index) uuidIndex.erase(it);
+
+    HandleSlot& slot = handleSlots[handle.index];
+    slot.object = ObjectHandle::NullIndex;
+    ++slot.generation;
+    freeHandles.push_back(handle.index);
+    obj->SetHandle({});
+    return obj;
 }
 
 void World::RemoveObject(const UUID& uuid) {
@@ -237,21 +984,73 @@ void World::RemoveObject(const UUID& uuid) {
 
 UUID World::AddObject(std::unique_ptr<GameObject> obj) {
     if (!obj) throw std::invalid_argument("Cannot add null GameObject");
+    std::unique_lock lock(queryMutex);
 
     GameObject* rawPtr = obj.get();
     rawPtr->SetWorld(this);
+    bodies.Add(rawPtr);
+    BindSystemComponents(rawPtr);
+
+    uint32_t index;
+    if (!freeHandles.empty()) {
+        index = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        index = static_cast<uint32_t>(handleSlots.size());
+        handleSlots.emplace_back();
+    }
+    handleSlots[index].object = static_cast<uint32_t>(objects.size());
+    rawPtr->SetHandle({ index, handleSlots[index].generation });
+    scheduler.Add(rawPtr, index, tickTime);
+    for (TagId tag : rawPtr->GetTags()) IndexTag(rawPtr, tag);
+
     UUID id = rawPtr->GetUUID();
+    uuidIndex.try_emplace(id, index);
     objects.push_back(std::move(obj));
-
-    rawPtr->Destroyed.Connect([this, rawPtr]() {
-        if (std::find(destroyQueue.begin(), destroyQueue.end(), rawPtr) == destroyQueue.end()) {
-            destroyQueue.push_back(rawPtr);
-        }
-    });
+    if (rawPtr->IsAnchored()) staticGeometryDirty = true;
 
     return id;
 }
 
+void World::ReindexUuid(const UUID& previous, const UUID& current) {
+    auto it = uuidIndex.find(previous);
+    if (it == uuidIndex.end() || objects[handleSlots[it->second].object]->GetUUID() != current) return;
+
+    uint32_t index = it->second;
+    uuidIndex.erase(it);
+    uuidIndex.try_emplace(current, index);
+}
+
+void World::OnObjectTagChanged(GameObject* obj, TagId tag, bool added) {
+    if (!Contains(obj)) return;
+    if (added) IndexTag(obj, tag);
+    else UnindexTag(obj, tag);
+}
+
+void World::IndexTag(GameObject* obj, TagId tag) {
+    if (tag >= tagIndex.size()) tagIndex.resize(tag + 1);
+    TagBucket& bucket = tagIndex[tag];
+    uint32_t slot = obj->GetHandle().index;
+    if (slot >= bucket.positions.size()) bucket.positions.resize(slot + 1);
+    bucket.positions[slot] = static_cast<uint32_t>(bucket.objects.size());
+    bucket.objects.push_back(obj);
+}
+
+void World::UnindexTag(GameObject* obj, TagId tag) {
+    TagBucket& bucket = tagIndex[tag];
+    uint32_t position = bucket.positions[obj->GetHandle().index];
+    if (position + 1 != bucket.objects.size()) {
+        bucket.objects[position] = bucket.objects.back();
+        bucket.positions[bucket.objects[position]->GetHandle().index] = position;
+    }
+    bucket.objects.pop_back();
+}
+
+const std::vector<GameObject*>& World::GetObjectsWithTag(TagId tag) const {
+    static const std::vector<GameObject*> none;
+    return tag < tagIndex.size() ? tagIndex[tag].objects : none;
+}
+
 std::string World::Dump() const {
     std::string result = "World(\n";
     for (auto& object : GetObjects()) {
@@ -0,0 +1,92 @@
+#include "Core/World/WorldEventBuffer.h"
+#include "Core/Objects/GameObject.h"
+#include "Core/World/World.h"
+#include <algorithm>
+#include <utility>
+
+void WorldEventBuffer::Begin() {
+    recording = true;
+    if (++stamp == 0) {
+        // Wrapped: forget every old stamp so none can match the new ones
+        std::fill(movedStamps.begin(), movedStamps.end(), MovedStamp{});
+        stamp = 1;
+    }
+
+    moved.clear();
+    collisions.clear();
+    collisionKeys.clear();
+    destroyed.clear();
+
+    previousTriggers.swap(triggers);
+    previousTriggerKeys.swap(triggerKeys);
+    triggers.clear();
+    triggerKeys.clear();
+}
+
+void WorldEventBuffer::RecordMoved(const GameObject* obj) {
+    ObjectHandle handle = obj->GetHandle();
+    if (handle.index >= movedStamps.size()) movedStamps.resize(handle.index + 1);
+    MovedStamp& last = movedStamps[handle.index];
+    if (last.stamp == stamp && last.generation == handle.generation) return;
+    last = { stamp, handle.generation };
+    moved.push_back(handle);
+}
+
+void WorldEventBuffer::RecordCollision(const GameObject* a, const GameObject* b) {
+    if (collisionKeys.insert(KeyOf(a->GetHandle(), b->GetHandle())).second)
+        collisions.push_back({ a->GetHandle(), b->GetHandle() });
+}
+
+void WorldEventBuffer::RecordTriggerContact(const GameObject* a, const GameObject* b) {
+    if (triggerKeys.insert(KeyOf(a->GetHandle(), b->GetHandle())).second)
+        triggers.push_back({ a->GetHandle(), b->GetHandle() });
+}
+
+void WorldEventBuffer::RecordDestroyed(const GameObject* obj) {
+    destroyed.push_back(obj->GetHandle());
+}
+
+void WorldEventBuffer::Dispatch(const World& world) {
+    recording = false;
+
+    // Listeners may remove objects, so everything is resolved right before it fires
+    for (ObjectHandle handle : moved) {
+        if (GameObject* obj = world.Resolve(handle))
+            obj->Moved.Fire(obj->GetPosition());
+    }
+
+    for (const Pair& pair : collisions) {
+        GameObject* a = world.Resolve(pair.a);
+        GameObject* b = world.Resolve(pair.b);
+        if (!a || !b) continue;
+        if (b->IsStandIn()) std::swap(a, b);
+        a->OnCollision(b);
+        if (!a->IsStandIn() && world.Resolve(pair.a) && world.Resolve(pair.b))
+            b->OnCollision(a);
+    }
+
+    for (const Pair& pair : previousTriggers) {
+        if (triggerKeys.count(KeyOf(pair.a, pair.b))) continue;
+        GameObject* a = world.Resolve(pair.a);
+        GameObject* b = world.Resolve(pair.b);
+        if (!a || !b) continue;
+        a->TriggerExited.Fire(b);
+        if (world.Resolve(pair.a) && world.Resolve(pair.b))
+            b->TriggerExited.Fire(a);
+    }
+
+    for (const Pair& pair : triggers) {
+        if (previousTriggerKeys.count(KeyOf(pair.a, pair.b))) continue;
+        GameObject* a = world.Resolve(pair.a);
+        GameObject* b = world.Resolve(pair.b);
+        if (!a || !b) continue;
+        a->TriggerEntered.Fire(b);
+        if (world.Resolve(pair.a) && world.Resolve(pair.b))
+            b->TriggerEntered.Fire(a);
+    }
+
+    for (ObjectHandle handle : destroyed) {
+        if (GameObject* obj = world.Resolve(handle))
+            obj->Destroyed.Fire();
+    }
+}
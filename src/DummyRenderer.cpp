@@ -11,8 +11,7 @@ void DummyRenderer::ClearFrame() {
     std::cout << "[Renderer] Frame cleared.\n";
 }
 
-void DummyRenderer::DrawGameObject(const GameObject& obj) {
-    auto pos = obj.GetPosition();
+void DummyRenderer::DrawGameObject(const GameObject& obj, const Vector2d& pos) {
     std::cout << "[Renderer] Drawing object #" << obj.GetID()
               << " at (" << pos.x << ", " << pos.y << ")\n";
 }
@@ -8,6 +8,7 @@
 #include "Client/CommandQueue.h"
 #include "Client/Input/InputContext.h"
 #include "Core/Components/TransformComponent.h"
+#include "Util/FixedTimestep.h"
 
 class GameLoop {
 private:
@@ -20,7 +21,7 @@ private:
 
     std::vector<std::unique_ptr<InputContext>> contexts;
 
-    float tickRate = 0.014f; // ~64hz
+    FixedTimestep timestep{ 64.0 };
 
 public:
     GameLoop(World& w, RenderSystem& r) : world(w), renderer(r) {}
@@ -34,29 +35,31 @@ public:
         contexts.push_back(std::move(ctx));
     }
 
+    // Call before Start()
+    void SetTickRate(double hz) { timestep.SetTickRate(hz); }
+
 private:
     void StartServerThread() {
         serverThread = std::thread([this]() {
             using namespace std::chrono;
             using namespace std::chrono_literals;
 
-            auto lastTickTime = steady_clock::now();
-            auto lastReportTime = lastTickTime;
+            timestep.Reset();
+            auto lastReportTime = steady_clock::now();
             int tickCount = 0;
 
             while (running) {
-                auto now = steady_clock::now();
-                duration<double> deltaTime = now - lastTickTime;
-                lastTickTime = now;
+                timestep.WaitForNextTick();
 
                 {
                     std::lock_guard<std::mutex> lock(worldMutex);
-                    commandQueue.ExecuteAll();
-                    world.Tick(deltaTime.count()); // Pass seconds as double
+                    tickCount += timestep.Advance([this](double dt) {
+                        commandQueue.ExecuteAll();
+                        world.Tick(static_cast<float>(dt));
+                    });
                 }
 
-                tickCount++;
-
+                auto now = steady_clock::now();
                 if (now - lastReportTime >= 1s) {
                     double tps = tickCount / duration_cast<duration<double>>(now - lastReportTime).count();
                     std::cout << "[Server] Real-Time Tick Rate: " << tps << " ticks/sec\n";
@@ -64,8 +67,6 @@ private:
                     tickCount = 0;
                     lastReportTime = now;
                 }
-
-                std::this_thread::sleep_for(7ms);
             }
 
             std::cout << "[Server] Stopped.\n";
@@ -81,8 +82,9 @@ private:
             }
 
             {
+                // The timestep is only advanced under this lock, so the alpha is consistent with the world
                 std::lock_guard<std::mutex> lock(worldMutex);
-                renderer.RenderWorld(world);
+                renderer.RenderWorld(world, timestep.GetAlpha());
             }
         }
 
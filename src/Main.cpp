@@ -26,12 +26,12 @@ int main() {
     auto& wall = world.SpawnObject<GameObject>();
     object.SetPosition({5, 60});
     object.GetTransform()->SetVelocity({ 80, 0 });
-    object.GetHitbox()->AddHitbox(std::make_unique<RectShape>(Rect2d { 0.0, 0.0, 15.0, 15.0 }, 0.0f));
-    // object.GetHitbox()->AddHitbox(std::make_unique<CircleShape>(Vector2d(0, 0), 15.0f));
+    object.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 15.0, 15.0 }, 0.0f));
+    // object.GetHitbox()->AddHitbox(CircleShape(Vector2d(0, 0), 15.0f));
     object.GetPhysicalProperties()->SetMass(100);
 
     wall.SetPosition({50, 40});
-    wall.GetHitbox()->AddHitbox(std::make_unique<RectShape>(Rect2d { 0.0, 0.0, 25.0, 100.0 }, 0.0f));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 25.0, 100.0 }, 0.0f));
     wall.GetPhysicalProperties()->SetAnchored(false);
     wall.GetPhysicalProperties()->SetMass(1);
     renderSystem.GetWorldRenderer().RegisterRenderer<PlayerEntity, PlayerRenderer>();
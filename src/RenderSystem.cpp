@@ -15,10 +15,10 @@ void RenderSystem::SetTitle(const std::string& title) {
     backend->SetTitle(title);
 }
 
-void RenderSystem::RenderWorld(const World& world) {
+void RenderSystem::RenderWorld(const World& world, double alpha) {
     if (!worldRenderer) return;
     backend->ClearFrame();
-    worldRenderer->Render(world);
+    worldRenderer->Render(world, alpha);
     backend->PresentFrame();
 }
 
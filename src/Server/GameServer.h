@@ -15,6 +15,8 @@
 #include "NetworkSystem.h"
 #include "Core/World/World.h"
 #include "Core/World/ServerWorld.h"
+#include "Core/World/ShardedWorld.h"
+#include "Util/FixedTimestep.h"
 #include <memory>
 
 using Util::UUID;
@@ -79,10 +81,13 @@ private:
         network.sendTo(clientID, pIO.EncodePacket(ack));
     }
 
+    std::unique_ptr<JobSystem> jobs; // shared by everything the server ticks; started by run()
     ServerWorld serverWorld = ServerWorld();
+    std::unique_ptr<ShardedWorld> shardedWorld; // ticked instead of serverWorld once sharding is enabled
     std::thread serverThread;
     std::mutex worldMutex;
     std::atomic<bool> running{false};
+    FixedTimestep timestep{ 64.0 };
 
 public:
     explicit GameServer(unsigned short port)
@@ -123,27 +128,33 @@ public:
     void run() {
         running = true;
 
+        // Workers for the other cores; the tick thread helps while it waits on them
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        jobs = std::make_unique<JobSystem>(cores - 1);
+        serverWorld.SetJobSystem(jobs.get());
+        if (shardedWorld) shardedWorld->SetJobSystem(jobs.get());
+
         serverThread = std::thread([this]() {
             using namespace std::chrono;
             using namespace std::chrono_literals;
 
-            auto lastTickTime = steady_clock::now();
-            auto lastReportTime = lastTickTime;
+            timestep.Reset();
+            auto lastReportTime = steady_clock::now();
             int tickCount = 0;
 
             while (running) {
-                auto now = steady_clock::now();
-                duration<double> deltaTime = now - lastTickTime;
-                lastTickTime = now;
+                timestep.WaitForNextTick();
 
                 {
                     std::lock_guard<std::mutex> lock(worldMutex);
-                    // commandQueue.ExecuteAll(); // execute player actions there
-                    serverWorld.Tick(deltaTime.count()); // Pass seconds as double
+                    tickCount += timestep.Advance([this](double dt) {
+                        // commandQueue.ExecuteAll(); // execute player actions there
+                        if (shardedWorld) shardedWorld->Tick(static_cast<float>(dt));
+                        else serverWorld.Tick(static_cast<float>(dt));
+                    });
                 }
 
-                tickCount++;
-
+                auto now = steady_clock::now();
                 if (now - lastReportTime >= 1s) {
                     double tps = tickCount / duration_cast<duration<double>>(now - lastReportTime).count();
                     // std::cout << "[Server] Real-Time Tick Rate: " << tps << " ticks/sec\n";
@@ -151,8 +162,6 @@ public:
                     tickCount = 0;
                     lastReportTime = now;
                 }
-
-                std::this_thread::sleep_for(7ms);
             }
 
             std::cout << "[Server] Stopped.\n";
@@ -161,6 +170,18 @@ public:
         io.run();
     }
 
+    // Call before run()
+    void setTickRate(double hz) { timestep.SetTickRate(hz); }
+
+    double getTickRate() const { return timestep.GetTickRate(); }
+
+    // Call before run(). Splits the simulation into regions ticked in parallel;
+    // objects then live in the sharded world rather than GetWorld(), and
+    // replicate through its ProcessReplicationQueue.
+    void enableSharding(const ShardSettings& settings) {
+        shardedWorld = std::make_unique<ShardedWorld>(true, settings);
+    }
+
     void broadcast(const std::vector<uint8_t>& msg) {
         network.broadcast(msg);
     }
@@ -175,6 +196,10 @@ public:
         running = false;
         if (serverThread.joinable())
             serverThread.join();
+
+        serverWorld.SetJobSystem(nullptr);
+        if (shardedWorld) shardedWorld->SetJobSystem(nullptr);
+        jobs.reset();
     }
 
     void disconnectClient(const UUID& id) {
@@ -215,4 +240,7 @@ public:
     }
 
     ServerWorld& GetWorld() { return serverWorld; }
+    ShardedWorld* GetShardedWorld() { return shardedWorld.get(); }
+    // nullptr until run()
+    JobSystem* GetJobSystem() { return jobs.get(); }
 };
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+enum class CatchUpPolicy : uint8_t {
+    // Run up to maxCatchUpTicks back to back, then drop whatever is still owed
+    Bounded,
+    // Run at most one tick per Advance and drop any backlog beyond it
+    Skip
+};
+
+// Fixed-step tick scheduler. Wall time is accumulated and spent in whole steps
+// of 1 / tickRate, so every tick sees the same dt regardless of how the OS
+// scheduled the thread. The fraction of a step left over is the interpolation
+// alpha a renderer can blend the last two ticks with.
+class FixedTimestep {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FixedTimestep(double tickRate = 64.0, CatchUpPolicy policy = CatchUpPolicy::Bounded,
+                           uint32_t maxCatchUpTicks = 8)
+        : policy(policy), maxCatchUpTicks(maxCatchUpTicks) {
+        SetTickRate(tickRate);
+        Reset();
+    }
+
+    void SetTickRate(double hz) {
+        step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / hz));
+        stepSeconds = std::chrono::duration<double>(step).count();
+    }
+
+    double GetTickRate() const { return 1.0 / stepSeconds; }
+    double GetStep() const { return stepSeconds; }
+
+    void SetCatchUpPolicy(CatchUpPolicy p, uint32_t maxTicks) { policy = p; maxCatchUpTicks = maxTicks; }
+
+    // How long before a deadline WaitForNextTick stops sleeping and starts spinning.
+    // OS sleeps routinely overshoot by a millisecond or more.
+    void SetSpinMargin(Clock::duration margin) { spinMargin = margin; }
+
+    // Restarts the clock and forgets any accumulated time
+    void Reset() {
+        last = Clock::now();
+        accumulator = Clock::duration::zero();
+    }
+
+    // Blocks until at least one tick is owed
+    void WaitForNextTick() const {
+        Clock::time_point due = last + (step - accumulator);
+        if (Clock::now() < due - spinMargin)
+            std::this_thread::sleep_until(due - spinMargin);
+        while (Clock::now() < due)
+            std::this_thread::yield();
+    }
+
+    // Adds the time since the last call and runs tick(step) once per whole step
+    // owed, subject to the catch-up policy. Returns how many ticks ran.
+    template <typename Fn>
+    uint32_t Advance(Fn&& tick) {
+        Clock::time_point now = Clock::now();
+        accumulator += now - last;
+        last = now;
+
+        uint32_t limit = policy == CatchUpPolicy::Skip ? 1 : maxCatchUpTicks;
+        uint32_t ran = 0;
+        while (accumulator >= step && ran < limit) {
+            tick(stepSeconds);
+            accumulator -= step;
+            ++ran;
+        }
+
+        // Still behind: give up on the backlog rather than spiralling
+        if (accumulator >= step) {
+            droppedTicks += static_cast<uint64_t>(accumulator / step);
+            accumulator %= step;
+        }
+
+        tickCount += ran;
+        return ran;
+    }
+
+    // Fraction of the next step already elapsed, in [0, 1]
+    double GetAlpha(Clock::time_point now = Clock::now()) const {
+        double alpha = std::chrono::duration<double>(accumulator + (now - last)).count() / stepSeconds;
+        return alpha < 0.0 ? 0.0 : (alpha > 1.0 ? 1.0 : alpha);
+    }
+
+    uint64_t GetTickCount() const { return tickCount; }
+    uint64_t GetDroppedTicks() const { return droppedTicks; }
+
+private:
+    Clock::duration step{};
+    double stepSeconds = 0.0;
+
+    CatchUpPolicy policy;
+    uint32_t maxCatchUpTicks;
+    Clock::duration spinMargin = std::chrono::milliseconds(2);
+
+    Clock::time_point last;
+    Clock::duration accumulator{};
+
+    uint64_t tickCount = 0;
+    uint64_t droppedTicks = 0;
+};
@@ -395,6 +395,15 @@ struct Rect2 {
     Rect2 Expanded(T r) const {
         return {Left() - r, Top() - r, width + 2*r, height + 2*r};
     }
+
+    // Smallest rect containing both this and other
+    constexpr Rect2 Union(const Rect2& other) const noexcept {
+        T nx = std::min(x, other.x);
+        T ny = std::min(y, other.y);
+        return {nx, ny,
+                std::max(Right(), other.Right()) - nx,
+                std::max(Bottom(), other.Bottom()) - ny};
+    }
 };
 
 using Rect2i = Rect2<int>;
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Core/Objects/Hitbox/HitboxShape.h"
+#include "Util/GMath.h"
+#include <array>
+#include <cmath>
+
+// Continuous separating-axis test for two translating convex shapes. Shapes only
+// ever translate, so a shape is read in its local space plus an offset: projecting
+// onto an axis is the local projection shifted by offset.Dot(axis). Nothing here
+// copies vertices, allocates or takes a square root.
+
+struct ConvexView {
+    const Vector2d* vertices = nullptr;
+    size_t vertexCount = 0;
+    const Vector2d* axes = nullptr;    // unit separating axes contributed by this shape
+    const double* axisMin = nullptr;   // the shape's own local projection onto each axis
+    const double* axisMax = nullptr;
+    size_t axisCount = 0;
+    Vector2d offset;                   // world position of the local origin
+
+    void Project(const Vector2d& axis, double& lo, double& hi) const {
+        lo = INFINITY;
+        hi = -INFINITY;
+        for (size_t i = 0; i < vertexCount; ++i) {
+            double p = vertices[i].Dot(axis);
+            lo = std::min(lo, p);
+            hi = std::max(hi, p);
+        }
+        double o = offset.Dot(axis);
+        lo += o;
+        hi += o;
+    }
+
+    static ConvexView Of(const PolygonShape& poly, const Vector2d& pos) {
+        const auto& verts = poly.GetVertices();
+        const auto& axes = poly.GetAxes();
+        return { verts.data(), verts.size(), axes.data(),
+                 poly.GetAxisMin().data(), poly.GetAxisMax().data(), axes.size(), pos };
+    }
+};
+
+// An axis-aligned rectangle laid out as a ConvexView, built on the stack
+class RectConvex {
+    static constexpr size_t AxisCount = 2;
+
+    std::array<Vector2d, 4> corners;
+    std::array<Vector2d, AxisCount> axes{ Vector2d{ 1, 0 }, Vector2d{ 0, 1 } };
+    std::array<double, AxisCount> axisMin, axisMax;
+
+public:
+    explicit RectConvex(const Rect2d& r)
+        : corners{ Vector2d{ r.Left(), r.Top() }, Vector2d{ r.Right(), r.Top() },
+                   Vector2d{ r.Right(), r.Bottom() }, Vector2d{ r.Left(), r.Bottom() } },
+          axisMin{ r.Left(), r.Top() }, axisMax{ r.Right(), r.Bottom() } {}
+
+    ConvexView View(const Vector2d& pos) const {
+        return { corners.data(), corners.size(), axes.data(), axisMin.data(), axisMax.data(), AxisCount, pos };
+    }
+};
+
+// Sweeps a (displaced by dispA) against b (displaced by dispB) over t in [0,1].
+// Shapes already overlapping hit at toi 0 with the axis of least penetration;
+// otherwise toi is the first time they overlap on every axis. The normal points
+// from b towards a, like SweptAABB's.
+inline bool SweepConvex(const ConvexView& a, const Vector2d& dispA,
+                        const ConvexView& b, const Vector2d& dispB,
+                        double& toi, Vector2d& normal) {
+    if (a.vertexCount == 0 || b.vertexCount == 0) return false;
+
+    Vector2d rel = dispA - dispB;
+    double tFirst = -INFINITY, tLast = INFINITY;
+    Vector2d firstNormal;
+    double minPenetration = INFINITY;
+    Vector2d penetrationNormal{ 0, 1 };
+
+    // Narrows [tFirst, tLast] by one axis; false once the shapes provably miss
+    auto testAxis = [&](const Vector2d& axis, double aLo, double aHi, double bLo, double bHi) {
+        double v = rel.Dot(axis);
+
+        if (aHi < bLo) {
+            if (v <= 0.0) return false;
+            double enter = (bLo - aHi) / v;
+            if (enter > tFirst) { tFirst = enter; firstNormal = -axis; }
+            tLast = std::min(tLast, (bHi - aLo) / v);
+        } else if (bHi < aLo) {
+            if (v >= 0.0) return false;
+            double enter = (bHi - aLo) / v;
+            if (enter > tFirst) { tFirst = enter; firstNormal = axis; }
+            tLast = std::min(tLast, (bLo - aHi) / v);
+        } else {
+            double below = aHi - bLo, above = bHi - aLo;
+            if (below < minPenetration) { minPenetration = below; penetrationNormal = -axis; }
+            if (above < minPenetration) { minPenetration = above; penetrationNormal = axis; }
+
+            if (v > 0.0) tLast = std::min(tLast, above / v);
+            else if (v < 0.0) tLast = std::min(tLast, -below / v);
+        }
+
+        return tFirst <= tLast && tFirst <= 1.0;
+    };
+
+    double lo, hi;
+    for (size_t i = 0; i < a.axisCount; ++i) {
+        const Vector2d& axis = a.axes[i];
+        double aOffset = a.offset.Dot(axis);
+        b.Project(axis, lo, hi);
+        if (!testAxis(axis, a.axisMin[i] + aOffset, a.axisMax[i] + aOffset, lo, hi)) return false;
+    }
+    for (size_t i = 0; i < b.axisCount; ++i) {
+        const Vector2d& axis = b.axes[i];
+        double bOffset = b.offset.Dot(axis);
+        a.Project(axis, lo, hi);
+        if (!testAxis(axis, lo, hi, b.axisMin[i] + bOffset, b.axisMax[i] + bOffset)) return false;
+    }
+
+    if (tFirst == -INFINITY) {
+        toi = 0.0;
+        normal = penetrationNormal;
+    } else {
+        toi = tFirst;
+        normal = firstNormal;
+    }
+    return true;
+}
@@ -2,6 +2,10 @@
 
 #include "Core/Objects/Hitbox/HitboxShape.h"
 #include "Util/GMath.h"
+#include "Util/Physics/ConvexSweep.h"
+#include "Util/Physics/ShapeQueries.h"
+#include <array>
+#include <utility>
 
 struct SweepResult {
     bool hit = false;
@@ -50,10 +54,12 @@ inline SweepResult SweptAABB(const Rect2d& a, const Vector2d& va,
     result.hit = true;
     result.toi = std::max(entryTime, 0.0);
 
+    // The normal opposes the relative motion on the entry axis. Deriving it from the
+    // sign of xInvEntry flipped it for boxes already touching (xInvEntry == 0).
     if (xEntry > yEntry)
-        result.normal = (xInvEntry < 0.0) ? Vector2d{1, 0} : Vector2d{-1, 0};
+        result.normal = (relVel.x > 0.0) ? Vector2d{-1, 0} : Vector2d{1, 0};
     else
-        result.normal = (yInvEntry < 0.0) ? Vector2d{0, 1} : Vector2d{0, -1};
+        result.normal = (relVel.y > 0.0) ? Vector2d{0, -1} : Vector2d{0, 1};
 
     return result;
 }
@@ -64,7 +70,8 @@ inline SweepResult SweptRectCircle(
     double dt
 ) {
     SweepResult result;
-    Vector2d relDisp = circleDisp - rectDisp;
+    // The expanded rectangle moves relative to the (point) circle
+    Vector2d relDisp = rectDisp - circleDisp;
 
     Rect2d rect = rectShape.GetBounds().Translated(rectPos);
     Vector2d circleCenter = circlePos + circleShape.GetCenter();
@@ -78,81 +85,19 @@ inline SweepResult SweptRectCircle(
 
     return result;
 }
-inline bool OverlapOnAxis(
-    const std::vector<Vector2d>& vertsA,
-    const std::vector<Vector2d>& vertsB,
-    const Vector2d& axis
-) {
-    double minA = INFINITY, maxA = -INFINITY;
-    double minB = INFINITY, maxB = -INFINITY;
-
-    for (const auto& v : vertsA) {
-        double proj = v.Dot(axis);
-        minA = std::min(minA, proj);
-        maxA = std::max(maxA, proj);
-    }
-    for (const auto& v : vertsB) {
-        double proj = v.Dot(axis);
-        minB = std::min(minB, proj);
-        maxB = std::max(maxB, proj);
-    }
-
-    return !(maxA < minB || maxB < minA);
-}
-
-inline bool SATIntersects(
-    const std::vector<Vector2d>& vertsA,
-    const std::vector<Vector2d>& vertsB
-) {
-    auto testAxes = [&](const std::vector<Vector2d>& verts) {
-        for (size_t i = 0; i < verts.size(); ++i) {
-            Vector2d p1 = verts[i];
-            Vector2d p2 = verts[(i + 1) % verts.size()];
-            Vector2d edge = p2 - p1;
-            Vector2d axis(-edge.y, edge.x);
-            axis = axis.Normalized();
-            if (!OverlapOnAxis(vertsA, vertsB, axis))
-                return false;
-        }
-        return true;
-    };
-
-    return testAxes(vertsA) && testAxes(vertsB);
-}
-
-// Discrete polygon sweep fallback
+// Continuous SAT sweep of two convex polygons
 inline SweepResult SweptPolygonSweep(
     const PolygonShape& polyA, const Vector2d& posA, const Vector2d& dispA,
     const PolygonShape& polyB, const Vector2d& posB, const Vector2d& dispB,
     double dt
 ) {
     SweepResult result;
-    std::vector<Vector2d> vertsA = polyA.GetVertices();
-    std::vector<Vector2d> vertsB = polyB.GetVertices();
-
-    for (auto& v : vertsA) v += posA;
-    for (auto& v : vertsB) v += posB;
-
-    // Discrete test at t=0 and t=1
-    if (SATIntersects(vertsA, vertsB)) {
-        result.hit = true;
-        result.toi = 0.0;
-        result.normal = {0, 1}; // default normal
-        return result;
-    }
-
-    for (auto& v : vertsA) v += dispA;
-    for (auto& v : vertsB) v += dispB;
-    if (SATIntersects(vertsA, vertsB)) {
-        result.hit = true;
-        result.toi = 1.0;
-        result.normal = {0, 1};
-    }
-
+    result.hit = SweepConvex(ConvexView::Of(polyA, posA), dispA, ConvexView::Of(polyB, posB), dispB,
+                             result.toi, result.normal);
     return result;
 }
 
-SweepResult SweptCircleCircle(
+inline SweepResult SweptCircleCircle(
     const CircleShape& aShape, const Vector2d& aPos, const Vector2d& aDisp,
     const CircleShape& bShape, const Vector2d& bPos, const Vector2d& bDisp,
     double dt
@@ -215,58 +160,181 @@ SweepResult SweptCircleCircle(
     return out;
 }
 
-inline SweepResult SweptShapeCollision(
-    const HitboxShape& aShape, const Vector2d& aPos, const Vector2d& aDisp,
-    const HitboxShape& bShape, const Vector2d& bPos, const Vector2d& bDisp,
+// Continuous circle/polygon sweep. The circle's center is swept as a point
+// against the polygon rounded by the radius, whose boundary is made of the edges
+// pushed out by r and arcs of radius r around the vertices; the first of those it
+// reaches is the time of impact. Shapes already overlapping hit at toi 0. The
+// normal points from the polygon's closest boundary point towards the circle's center.
+inline SweepResult SweptCirclePolygon(
+    const CircleShape& circle, const Vector2d& circlePos, const Vector2d& circleDisp,
+    const PolygonShape& poly, const Vector2d& polyPos, const Vector2d& polyDisp,
     double dt
 ) {
-    auto typeA = aShape.GetType();
-    auto typeB = bShape.GetType();
-
-    // Rect vs Rect
-    if (typeA == HitboxShapeType::Rectangle && typeB == HitboxShapeType::Rectangle) {
-        const auto& ra = static_cast<const RectShape&>(aShape);
-        const auto& rb = static_cast<const RectShape&>(bShape);
-        Rect2d rectA = ra.GetBounds().Translated(aPos);
-        Rect2d rectB = rb.GetBounds().Translated(bPos);
-        return SweptAABB(rectA, aDisp, rectB, bDisp, dt);
-    }
+    SweepResult result;
+    const auto& verts = poly.GetVertices();
+    if (verts.empty()) return result;
 
-    // Circle vs Circle
-    if (typeA == HitboxShapeType::Circle && typeB == HitboxShapeType::Circle) {
-        const auto& ca = static_cast<const CircleShape&>(aShape);
-        const auto& cb = static_cast<const CircleShape&>(bShape);
-        return SweptCircleCircle(ca, aPos, aDisp, cb, bPos, bDisp, dt);
-    }
+    double r = circle.GetRadius();
+    Vector2d center = circlePos + circle.GetCenter();
 
-    // Rect vs Circle
-    if (typeA == HitboxShapeType::Rectangle && typeB == HitboxShapeType::Circle) {
-        const auto& ra = static_cast<const RectShape&>(aShape);
-        const auto& cb = static_cast<const CircleShape&>(bShape);
-        return SweptRectCircle(ra, aPos, aDisp, cb, bPos, bDisp, dt);
-    }
+    if (ShapeQuery::OverlapsCircle(poly, polyPos, center, r)) {
+        Vector2d closest = verts[0] + polyPos;
+        double bestDist = INFINITY;
+        for (size_t i = 0; i < verts.size(); ++i) {
+            Vector2d a = verts[i] + polyPos;
+            Vector2d e = verts[(i + 1) % verts.size()] + polyPos - a;
+            double len = e.LengthSquared();
+            double s = len > 0.0 ? std::clamp((center - a).Dot(e) / len, 0.0, 1.0) : 0.0;
+            Vector2d p = a + e * s;
+            double d = (center - p).LengthSquared();
+            if (d < bestDist) { bestDist = d; closest = p; }
+        }
+
+        Vector2d n = center - closest;
+        if (ShapeQuery::PointInPolygon(verts, polyPos, center)) n = -n;
 
-    // Circle vs Rect (swap)
-    if (typeA == HitboxShapeType::Circle && typeB == HitboxShapeType::Rectangle) {
-        auto res = SweptRectCircle(
-            static_cast<const RectShape&>(bShape), bPos, bDisp,
-            static_cast<const CircleShape&>(aShape), aPos, aDisp, dt
-        );
-        res.normal = -res.normal; // flip direction since we swapped
-        return res;
+        result.hit = true;
+        result.toi = 0.0;
+        result.normal = n.LengthSquared() > 1e-12 ? n.Normalized() : Vector2d{0, 1};
+        return result;
     }
 
-    // Polygon vs Polygon (discrete fallback)
-    if (typeA == HitboxShapeType::Polygon && typeB == HitboxShapeType::Polygon) {
-        return SweptPolygonSweep(
-            static_cast<const PolygonShape&>(aShape), aPos, aDisp,
-            static_cast<const PolygonShape&>(bShape), bPos, bDisp, dt
-        );
+    // In the polygon's frame, the center moves from `center` along rel
+    Vector2d rel = circleDisp - polyDisp;
+    double speed = rel.LengthSquared();
+    if (speed < 1e-12) return result;
+
+    double best = INFINITY;
+    Vector2d bestNormal;
+    for (size_t i = 0; i < verts.size(); ++i) {
+        Vector2d a = verts[i] + polyPos;
+        Vector2d e = verts[(i + 1) % verts.size()] + polyPos - a;
+
+        // The edge pushed out by r, on whichever side the center starts on
+        double len = e.LengthSquared();
+        if (len > 1e-12) {
+            Vector2d n = Vector2d(-e.y, e.x) / std::sqrt(len);
+            double d = (center - a).Dot(n);
+            if (d < 0.0) { n = -n; d = -d; }
+            double v = rel.Dot(n);
+            if (d >= r && v < 0.0) {
+                double t = (d - r) / -v;
+                double s = (center + rel * t - a).Dot(e) / len;
+                if (t < best && s >= 0.0 && s <= 1.0) { best = t; bestNormal = n; }
+            }
+        }
+
+        // The arc around the vertex: |center + rel * t - a| = r
+        Vector2d off = center - a;
+        double b = off.Dot(rel);
+        double c = off.LengthSquared() - r * r;
+        double disc = b * b - speed * c;
+        if (b < 0.0 && disc >= 0.0) {
+            double t = (-b - std::sqrt(disc)) / speed;
+            if (t < best) { best = t; bestNormal = (off + rel * t) / r; }
+        }
     }
 
-    // Mixed polygon cases — discrete test fallback
+    if (best > 1.0) return result;
+    result.hit = true;
+    result.toi = std::max(best, 0.0);
+    result.normal = bestNormal.LengthSquared() > 1e-12 ? bestNormal.Normalized() : Vector2d{0, 1};
+    return result;
+}
+
+// Narrowphase for every pair of concrete shapes. SweptShapeCollision reaches these
+// through a table built from the overload set, so a missing pairing fails to compile.
+namespace ShapeSweep {
+
+inline SweepResult Sweep(const RectShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const RectShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweptAABB(a.GetBounds().Translated(aPos), aDisp, b.GetBounds().Translated(bPos), bDisp, dt);
+}
+
+inline SweepResult Sweep(const RectShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const CircleShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweptRectCircle(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+inline SweepResult Sweep(const RectShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const PolygonShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
     SweepResult result;
-    result.hit = false;
+    RectConvex rect(a.GetBounds());
+    result.hit = SweepConvex(rect.View(aPos), aDisp, ConvexView::Of(b, bPos), bDisp, result.toi, result.normal);
     return result;
 }
 
+inline SweepResult Sweep(const CircleShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const CircleShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweptCircleCircle(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+inline SweepResult Sweep(const CircleShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const PolygonShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweptCirclePolygon(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+inline SweepResult Sweep(const PolygonShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const PolygonShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweptPolygonSweep(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+// The remaining pairings swap their operands, so the normal is flipped back
+template <typename A, typename B>
+inline SweepResult SweepSwapped(const A& a, const Vector2d& aPos, const Vector2d& aDisp,
+                                const B& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    SweepResult res = Sweep(b, bPos, bDisp, a, aPos, aDisp, dt);
+    res.normal = -res.normal;
+    return res;
+}
+
+inline SweepResult Sweep(const CircleShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const RectShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweepSwapped(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+inline SweepResult Sweep(const PolygonShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const RectShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweepSwapped(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+inline SweepResult Sweep(const PolygonShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                         const CircleShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return SweepSwapped(a, aPos, aDisp, b, bPos, bDisp, dt);
+}
+
+using SweepFn = SweepResult (*)(const HitboxShape&, const Vector2d&, const Vector2d&,
+                                const HitboxShape&, const Vector2d&, const Vector2d&, double);
+
+template <size_t I>
+using ShapeAt = std::variant_alternative_t<I, HitboxShape::Storage>;
+
+template <size_t I, size_t J>
+SweepResult Entry(const HitboxShape& a, const Vector2d& aPos, const Vector2d& aDisp,
+                  const HitboxShape& b, const Vector2d& bPos, const Vector2d& bDisp, double dt) {
+    return Sweep(a.As<ShapeAt<I>>(), aPos, aDisp, b.As<ShapeAt<J>>(), bPos, bDisp, dt);
+}
+
+template <size_t I, size_t... J>
+constexpr std::array<SweepFn, sizeof...(J)> MakeRow(std::index_sequence<J...>) {
+    return { &Entry<I, J>... };
+}
+
+template <size_t... I>
+constexpr std::array<std::array<SweepFn, sizeof...(I)>, sizeof...(I)> MakeTable(std::index_sequence<I...> types) {
+    return { MakeRow<I>(types)... };
+}
+
+// Indexed [typeA][typeB]
+inline constexpr auto Table = MakeTable(std::make_index_sequence<HitboxShape::TypeCount>{});
+
+} // namespace ShapeSweep
+
+inline SweepResult SweptShapeCollision(
+    const HitboxShape& aShape, const Vector2d& aPos, const Vector2d& aDisp,
+    const HitboxShape& bShape, const Vector2d& bPos, const Vector2d& bDisp,
+    double dt
+) {
+    return ShapeSweep::Table[static_cast<size_t>(aShape.GetType())][static_cast<size_t>(bShape.GetType())](
+        aShape, aPos, aDisp, bShape, bPos, bDisp, dt);
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "Core/Objects/Hitbox/HitboxShape.h"
+#include "Util/GMath.h"
+#include <cmath>
+
+// Static (non-swept) tests of a single hitbox shape placed at `pos`, used by
+// World's query API. Polygons are treated as convex. None of these allocate.
+
+namespace ShapeQuery {
+
+inline double Cross(const Vector2d& a, const Vector2d& b) { return a.x * b.y - a.y * b.x; }
+
+// Projects the polygon `verts`, offset by `pos`, onto `axis`
+inline void Project(const std::vector<Vector2d>& verts, const Vector2d& pos, const Vector2d& axis,
+                    double& lo, double& hi) {
+    lo = INFINITY;
+    hi = -INFINITY;
+    for (const auto& v : verts) {
+        double p = (v + pos).Dot(axis);
+        lo = std::min(lo, p);
+        hi = std::max(hi, p);
+    }
+}
+
+inline void ProjectRect(const Rect2d& r, const Vector2d& axis, double& lo, double& hi) {
+    double cx = r.x + r.width * 0.5, cy = r.y + r.height * 0.5;
+    double c = cx * axis.x + cy * axis.y;
+    double e = std::abs(axis.x) * r.width * 0.5 + std::abs(axis.y) * r.height * 0.5;
+    lo = c - e;
+    hi = c + e;
+}
+
+inline bool PointInPolygon(const std::vector<Vector2d>& verts, const Vector2d& pos, const Vector2d& point) {
+    bool inside = false;
+    for (size_t i = 0, j = verts.size() - 1; i < verts.size(); j = i++) {
+        Vector2d a = verts[i] + pos, b = verts[j] + pos;
+        if ((a.y > point.y) != (b.y > point.y) &&
+            point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+            inside = !inside;
+    }
+    return inside;
+}
+
+// Segment origin + dir * t, t in [0, maxDistance], against the shape. dir must be
+// normalized. t and normal receive the entry point; a ray starting inside hits at 0
+// with normal -dir.
+inline bool Raycast(const HitboxShape& shape, const Vector2d& pos,
+                    const Vector2d& origin, const Vector2d& dir, double maxDistance,
+                    double& t, Vector2d& normal) {
+    switch (shape.GetType()) {
+        case HitboxShapeType::Rectangle: {
+            Rect2d box = shape.As<RectShape>().GetBounds().Translated(pos);
+            double tMin = 0.0, tMax = maxDistance;
+            Vector2d n = -dir;
+
+            const double o[2] = { origin.x, origin.y };
+            const double d[2] = { dir.x, dir.y };
+            const double lo[2] = { box.Left(), box.Top() };
+            const double hi[2] = { box.Right(), box.Bottom() };
+            for (int axis = 0; axis < 2; ++axis) {
+                if (d[axis] == 0.0) {
+                    if (o[axis] < lo[axis] || o[axis] > hi[axis]) return false;
+                    continue;
+                }
+                double t1 = (lo[axis] - o[axis]) / d[axis];
+                double t2 = (hi[axis] - o[axis]) / d[axis];
+                double sign = -1.0;
+                if (t1 > t2) { std::swap(t1, t2); sign = 1.0; }
+                if (t1 > tMin) {
+                    tMin = t1;
+                    n = axis == 0 ? Vector2d{ sign, 0 } : Vector2d{ 0, sign };
+                }
+                tMax = std::min(tMax, t2);
+                if (tMin > tMax) return false;
+            }
+            t = tMin;
+            normal = n;
+            return true;
+        }
+        case HitboxShapeType::Circle: {
+            const auto& circle = shape.As<CircleShape>();
+            Vector2d center = circle.GetCenter() + pos;
+            double r = circle.GetRadius();
+
+            Vector2d m = origin - center;
+            double c = m.Dot(m) - r * r;
+            if (c <= 0.0) {
+                t = 0.0;
+                normal = -dir;
+                return true;
+            }
+
+            double b = m.Dot(dir);
+            double disc = b * b - c;
+            if (b > 0.0 || disc < 0.0) return false;
+
+            double hit = -b - std::sqrt(disc);
+            if (hit > maxDistance) return false;
+            t = hit;
+            normal = (origin + dir * hit - center) / r;
+            return true;
+        }
+        case HitboxShapeType::Polygon: {
+            const auto& verts = shape.As<PolygonShape>().GetVertices();
+            if (verts.size() < 3) return false;
+
+            if (PointInPolygon(verts, pos, origin)) {
+                t = 0.0;
+                normal = -dir;
+                return true;
+            }
+
+            bool found = false;
+            double best = maxDistance;
+            for (size_t i = 0; i < verts.size(); ++i) {
+                Vector2d a = verts[i] + pos;
+                Vector2d e = verts[(i + 1) % verts.size()] + pos - a;
+                double denom = Cross(dir, e);
+                if (std::abs(denom) < 1e-12) continue;
+
+                Vector2d ao = a - origin;
+                double hit = Cross(ao, e) / denom;
+                double s = Cross(ao, dir) / denom;
+                if (hit < 0.0 || hit > best || s < 0.0 || s > 1.0) continue;
+
+                best = hit;
+                found = true;
+                Vector2d n = Vector2d{ e.y, -e.x }.Normalized();
+                normal = n.Dot(dir) > 0.0 ? -n : n;
+            }
+            if (found) t = best;
+            return found;
+        }
+    }
+    return false;
+}
+
+inline bool OverlapsRect(const HitboxShape& shape, const Vector2d& pos, const Rect2d& rect) {
+    switch (shape.GetType()) {
+        case HitboxShapeType::Rectangle:
+            return shape.As<RectShape>().GetBounds().Translated(pos).Intersects(rect);
+        case HitboxShapeType::Circle: {
+            const auto& circle = shape.As<CircleShape>();
+            Vector2d c = circle.GetCenter() + pos;
+            double dx = c.x - std::clamp(c.x, rect.Left(), rect.Right());
+            double dy = c.y - std::clamp(c.y, rect.Top(), rect.Bottom());
+            double r = circle.GetRadius();
+            return dx * dx + dy * dy <= r * r;
+        }
+        case HitboxShapeType::Polygon: {
+            const auto& poly = shape.As<PolygonShape>();
+            if (poly.GetVertices().empty()) return false;
+
+            // Rect axes are the polygon's cached bounds
+            if (!poly.GetLocalBounds().Translated(pos).Intersects(rect)) return false;
+
+            // Polygon axes, using its cached projections
+            double rlo, rhi;
+            const auto& axes = poly.GetAxes();
+            for (size_t i = 0; i < axes.size(); ++i) {
+                double o = pos.Dot(axes[i]);
+                ProjectRect(rect, axes[i], rlo, rhi);
+                if (poly.GetAxisMax()[i] + o < rlo || rhi < poly.GetAxisMin()[i] + o) return false;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Convex polygon, offset by `pos`, against a circle
+inline bool OverlapsCircle(const PolygonShape& poly, const Vector2d& pos, const Vector2d& center, double radius) {
+    const auto& verts = poly.GetVertices();
+    if (verts.empty()) return false;
+
+    // The polygon's cached axes plus the axis towards the closest vertex
+    const auto& axes = poly.GetAxes();
+    for (size_t i = 0; i < axes.size(); ++i) {
+        double o = pos.Dot(axes[i]);
+        double c = center.Dot(axes[i]);
+        if (poly.GetAxisMax()[i] + o < c - radius || c + radius < poly.GetAxisMin()[i] + o) return false;
+    }
+
+    Vector2d closest = verts[0] + pos;
+    for (const auto& v : verts)
+        if ((v + pos - center).LengthSquared() < (closest - center).LengthSquared()) closest = v + pos;
+
+    Vector2d axis = (closest - center).Normalized();
+    if (axis.LengthSquared() == 0) return true;
+    double lo, hi;
+    Project(verts, pos, axis, lo, hi);
+    double c = center.Dot(axis);
+    return !(hi < c - radius || c + radius < lo);
+}
+
+inline bool OverlapsCircle(const HitboxShape& shape, const Vector2d& pos, const Vector2d& center, double radius) {
+    switch (shape.GetType()) {
+        case HitboxShapeType::Rectangle: {
+            Rect2d box = shape.As<RectShape>().GetBounds().Translated(pos);
+            double dx = center.x - std::clamp(center.x, box.Left(), box.Right());
+            double dy = center.y - std::clamp(center.y, box.Top(), box.Bottom());
+            return dx * dx + dy * dy <= radius * radius;
+        }
+        case HitboxShapeType::Circle: {
+            const auto& circle = shape.As<CircleShape>();
+            double r = circle.GetRadius() + radius;
+            return (circle.GetCenter() + pos - center).LengthSquared() <= r * r;
+        }
+        case HitboxShapeType::Polygon:
+            return OverlapsCircle(shape.As<PolygonShape>(), pos, center, radius);
+    }
+    return false;
+}
+
+} // namespace ShapeQuery
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "Util/Physics/RectSwept.h"
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Sweeps one moving rectangle against many rectangles at once. The targets are
+// packed as structure-of-arrays so a vector register holds the same field of
+// several rectangles; each lane repeats SweptAABB's arithmetic operation for
+// operation, so the batch result is bit-identical to a scalar loop.
+
+enum class SweepNormal : uint8_t {
+    NegX, // {-1, 0}
+    PosX, // { 1, 0}
+    NegY, // { 0,-1}
+    PosY  // { 0, 1}
+};
+
+inline Vector2d SweepNormalVector(SweepNormal n) {
+    switch (n) {
+        case SweepNormal::NegX: return { -1, 0 };
+        case SweepNormal::PosX: return { 1, 0 };
+        case SweepNormal::NegY: return { 0, -1 };
+        default:                return { 0, 1 };
+    }
+}
+
+inline SweepNormal SweepNormalIndex(const Vector2d& n) {
+    if (n.x < 0.0) return SweepNormal::NegX;
+    if (n.x > 0.0) return SweepNormal::PosX;
+    return n.y < 0.0 ? SweepNormal::NegY : SweepNormal::PosY;
+}
+
+// Targets of a batch sweep; dx/dy is each rectangle's own displacement over the interval
+class RectBatch {
+public:
+    std::vector<double> x, y, w, h, dx, dy;
+
+    void Push(const Rect2d& rect, const Vector2d& displacement = {}) {
+        x.push_back(rect.x);
+        y.push_back(rect.y);
+        w.push_back(rect.width);
+        h.push_back(rect.height);
+        dx.push_back(displacement.x);
+        dy.push_back(displacement.y);
+    }
+
+    void Reserve(size_t n) {
+        x.reserve(n); y.reserve(n); w.reserve(n); h.reserve(n); dx.reserve(n); dy.reserve(n);
+    }
+
+    void Clear() {
+        x.clear(); y.clear(); w.clear(); h.clear(); dx.clear(); dy.clear();
+    }
+
+    size_t Size() const { return x.size(); }
+    bool Empty() const { return x.empty(); }
+
+    Rect2d GetRect(size_t i) const { return { x[i], y[i], w[i], h[i] }; }
+    Vector2d GetDisplacement(size_t i) const { return { dx[i], dy[i] }; }
+};
+
+struct BatchSweepResult {
+    bool hit = false;
+    double toi = 1.0;
+    uint32_t index = 0;                    // position of the hit rectangle in the batch
+    SweepNormal normal = SweepNormal::NegX; // contact normal pointing from A -> B
+
+    Vector2d GetNormal() const { return SweepNormalVector(normal); }
+};
+
+namespace SweptBatchDetail {
+
+// Reference path and tail handler: exactly what a caller looping over SweptAABB would get
+inline void SweepScalar(const Rect2d& a, const Vector2d& va, const RectBatch& batch,
+                        size_t begin, size_t end, double& best, BatchSweepResult& result) {
+    for (size_t i = begin; i < end; ++i) {
+        SweepResult res = SweptAABB(a, va, batch.GetRect(i), batch.GetDisplacement(i), 1.0);
+        if (!res.hit || !(res.toi < best)) continue;
+
+        best = res.toi;
+        result = { true, res.toi, static_cast<uint32_t>(i), SweepNormalIndex(res.normal) };
+    }
+}
+
+#if defined(__AVX__)
+
+struct Lanes {
+    using V = __m256d;
+    static constexpr size_t Width = 4;
+
+    static V Load(const double* p) { return _mm256_loadu_pd(p); }
+    static void Store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    static V Set1(double v) { return _mm256_set1_pd(v); }
+    static V Add(V a, V b) { return _mm256_add_pd(a, b); }
+    static V Sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static V Div(V a, V b) { return _mm256_div_pd(a, b); }
+    static V Gt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static V Lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static V Eq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static V And(V a, V b) { return _mm256_and_pd(a, b); }
+    static V Or(V a, V b) { return _mm256_or_pd(a, b); }
+    static V Select(V mask, V ifFalse, V ifTrue) { return _mm256_blendv_pd(ifFalse, ifTrue, mask); }
+    static int Mask(V v) { return _mm256_movemask_pd(v); }
+};
+
+#elif defined(__SSE2__)
+
+struct Lanes {
+    using V = __m128d;
+    static constexpr size_t Width = 2;
+
+    static V Load(const double* p) { return _mm_loadu_pd(p); }
+    static void Store(double* p, V v) { _mm_storeu_pd(p, v); }
+    static V Set1(double v) { return _mm_set1_pd(v); }
+    static V Add(V a, V b) { return _mm_add_pd(a, b); }
+    static V Sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static V Div(V a, V b) { return _mm_div_pd(a, b); }
+    static V Gt(V a, V b) { return _mm_cmpgt_pd(a, b); }
+    static V Lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+    static V Eq(V a, V b) { return _mm_cmpeq_pd(a, b); }
+    static V And(V a, V b) { return _mm_and_pd(a, b); }
+    static V Or(V a, V b) { return _mm_or_pd(a, b); }
+    static V Select(V mask, V ifFalse, V ifTrue) {
+        return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+    }
+    static int Mask(V v) { return _mm_movemask_pd(v); }
+};
+
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__)
+
+// Returns how many rectangles were handled; the caller finishes the tail with SweepScalar
+inline size_t SweepLanes(const Rect2d& a, const Vector2d& va, const RectBatch& batch,
+                         double& best, BatchSweepResult& result) {
+    using L = Lanes;
+    using V = L::V;
+
+    const V zero = L::Set1(0.0);
+    const V one = L::Set1(1.0);
+    const V negInf = L::Set1(-INFINITY);
+    const V posInf = L::Set1(INFINITY);
+    const V aLeft = L::Set1(a.Left()), aRight = L::Set1(a.Right());
+    const V aTop = L::Set1(a.Top()), aBottom = L::Set1(a.Bottom());
+    const V vax = L::Set1(va.x), vay = L::Set1(va.y);
+
+    alignas(32) double toi[L::Width];
+    size_t n = batch.Size() - batch.Size() % L::Width;
+
+    for (size_t i = 0; i < n; i += L::Width) {
+        V bLeft = L::Load(&batch.x[i]);
+        V bTop = L::Load(&batch.y[i]);
+        V bRight = L::Add(bLeft, L::Load(&batch.w[i]));
+        V bBottom = L::Add(bTop, L::Load(&batch.h[i]));
+        V relX = L::Sub(vax, L::Load(&batch.dx[i]));
+        V relY = L::Sub(vay, L::Load(&batch.dy[i]));
+
+        V posX = L::Gt(relX, zero);
+        V posY = L::Gt(relY, zero);
+        V xInvEntry = L::Select(posX, L::Sub(bRight, aLeft), L::Sub(bLeft, aRight));
+        V xInvExit  = L::Select(posX, L::Sub(bLeft, aRight), L::Sub(bRight, aLeft));
+        V yInvEntry = L::Select(posY, L::Sub(bBottom, aTop), L::Sub(bTop, aBottom));
+        V yInvExit  = L::Select(posY, L::Sub(bTop, aBottom), L::Sub(bBottom, aTop));
+
+        // Lanes with no relative motion divide by zero here; the result is discarded
+        V stillX = L::Eq(relX, zero);
+        V stillY = L::Eq(relY, zero);
+        V xEntry = L::Select(stillX, L::Div(xInvEntry, relX), negInf);
+        V xExit  = L::Select(stillX, L::Div(xInvExit, relX), posInf);
+        V yEntry = L::Select(stillY, L::Div(yInvEntry, relY), negInf);
+        V yExit  = L::Select(stillY, L::Div(yInvExit, relY), posInf);
+
+        // std::max / std::min keep their first argument on ties, and so do these
+        V entry = L::Select(L::Lt(xEntry, yEntry), xEntry, yEntry);
+        V exit = L::Select(L::Lt(yExit, xExit), xExit, yExit);
+
+        V miss = L::Or(L::Gt(entry, exit),
+                 L::Or(L::And(L::Lt(xEntry, zero), L::Lt(yEntry, zero)),
+                       L::Gt(entry, one)));
+        int hits = ~L::Mask(miss) & ((1 << L::Width) - 1);
+        if (!hits) continue;
+
+        L::Store(toi, L::Select(L::Lt(entry, zero), entry, zero));
+        int xAxis = L::Mask(L::Gt(xEntry, yEntry));
+        int xPositive = L::Mask(posX);
+        int yPositive = L::Mask(posY);
+
+        // Lanes are reduced in order so ties resolve to the lowest index, as in the scalar loop
+        for (size_t lane = 0; lane < L::Width; ++lane) {
+            int bit = 1 << lane;
+            if (!(hits & bit) || !(toi[lane] < best)) continue;
+
+            best = toi[lane];
+            result.hit = true;
+            result.toi = toi[lane];
+            result.index = static_cast<uint32_t>(i + lane);
+            if (xAxis & bit)
+                result.normal = (xPositive & bit) ? SweepNormal::NegX : SweepNormal::PosX;
+            else
+                result.normal = (yPositive & bit) ? SweepNormal::NegY : SweepNormal::PosY;
+        }
+    }
+
+    return n;
+}
+
+#endif
+
+} // namespace SweptBatchDetail
+
+// Earliest hit of the moving rectangle a (displaced by va) against every rectangle in
+// the batch, considering only impacts with toi < limit. Equivalent to calling SweptAABB
+// on each entry in order and keeping the first strictly earlier hit.
+inline BatchSweepResult SweptAABBBatch(const Rect2d& a, const Vector2d& va, const RectBatch& batch,
+                                       double limit = INFINITY) {
+    BatchSweepResult result;
+    double best = limit;
+    size_t done = 0;
+
+#if defined(__AVX__) || defined(__SSE2__)
+    done = SweptBatchDetail::SweepLanes(a, va, batch, best, result);
+#endif
+
+    SweptBatchDetail::SweepScalar(a, va, batch, done, batch.Size(), best, result);
+    return result;
+}
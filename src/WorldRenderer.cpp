@@ -7,15 +7,16 @@ WorldRenderer::WorldRenderer(IRenderer& backend)
 
 WorldRenderer::~WorldRenderer() = default;
 
-void WorldRenderer::Render(const World& world) {
+void WorldRenderer::Render(const World& world, double alpha) {
     for (const auto& obj : world.GetObjects()) {
         if (!obj || !obj->ShouldRender()) continue;
+        Vector2d position = world.GetRenderPosition(*obj, alpha);
         std::type_index typeIdx(typeid(*obj));
         auto it = renderers.find(typeIdx);
         if (it != renderers.end()) {
-            it->second->Render(*obj, backend, Camera());
+            it->second->Render(*obj, position, backend, Camera());
         } else {
-            backend.DrawGameObject(*obj);
+            backend.DrawGameObject(*obj, position);
         }
     }
 }
\ No newline at end of file
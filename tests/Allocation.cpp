@@ -0,0 +1,76 @@
+#include "Core/World/World.h"
+#include "Core/Objects/PlayerEntity.h"
+#include "Core/SlabAllocator.h"
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+// Heap allocation tests: every operator new in this binary is counted
+
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size) {
+    ++heapAllocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+static GameObject& SpawnBox(World& world, double x, double vx) {
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(x, 0));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d{ 0.0, 0.0, 10.0, 10.0 }, 0.0f));
+    box.SetVelocity(Vector2d(vx, 0));
+    return box;
+}
+
+// Once scratch buffers and pools have grown, ticking a world with moving and
+// colliding bodies must not touch the heap
+static void TestSteadyStateTickIsAllocationFree() {
+    World world(true);
+    for (int i = 0; i < 200; ++i)
+        SpawnBox(world, i * 20.0, i % 2 ? 40.0 : -40.0);
+    world.SpawnObject<PlayerEntity>().SetHealAmount(1);
+
+    for (int i = 0; i < 60; ++i) world.Tick(1.0f / 60.0f);
+
+    size_t before = heapAllocations;
+    for (int i = 0; i < 60; ++i) {
+        world.Tick(1.0f / 60.0f);
+        assert(world.GetTickSystemAllocationCount() == 0);
+    }
+    assert(heapAllocations == before);
+}
+
+// Objects and components go back to their pools, and spawning again reuses them
+static void TestDestroyedObjectsAreReused() {
+    World world(true);
+    std::vector<GameObject*> spawned;
+
+    auto churn = [&] {
+        for (int i = 0; i < 100; ++i) {
+            spawned.push_back(&SpawnBox(world, i * 20.0, 0.0));
+            spawned.push_back(&world.SpawnObject<PlayerEntity>());
+        }
+        world.Tick(1.0f / 60.0f);
+        for (GameObject* obj : spawned) world.RemoveObject(obj);
+        spawned.clear();
+    };
+
+    // The first round also grows the world's own pooled tables, which it keeps
+    churn();
+    SlabAllocator::Stats warm = SlabAllocator::GetStats();
+
+    for (int round = 0; round < 10; ++round) churn();
+    SlabAllocator::Stats end = SlabAllocator::GetStats();
+    assert(end.systemAllocations == warm.systemAllocations);
+    assert(end.liveBlocks == warm.liveBlocks);
+    assert(end.allocations > warm.allocations);
+}
+
+int main() {
+    TestSteadyStateTickIsAllocationFree();
+    TestDestroyedObjectsAreReused();
+    return 0;
+}
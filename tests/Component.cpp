@@ -5,9 +5,82 @@
 #include "Core/Objects/Hitbox/HitboxShapeRegistry.h"
 #include <cassert>
 
-// Network encode/decode test
+// Network encode/decode test, plus component type ids, slot storage and tag atoms
+
+struct MarkerComponent : Component {
+    int value = 0;
+    explicit MarkerComponent(int v = 0) : value(v) {}
+    void Encode(PacketCodec&) const override {}
+    void Decode(PacketCodec&) override {}
+};
+
+struct DerivedHealthComponent : HealthComponent {};
+
+static void TestComponentIds() {
+    using namespace ComponentTypes;
+
+    // Built-ins are compile-time constants; anything else is numbered on first use
+    static_assert(FixedId<HealthComponent>::fixed);
+    static_assert(!FixedId<DerivedHealthComponent>::fixed);
+    assert(IdOf<TransformComponent>() == (ComponentTypeId)BuiltinComponent::Transform);
+    assert(IdOf<MarkerComponent>() >= (ComponentTypeId)BuiltinComponent::Count);
+    assert(IdOf<MarkerComponent>() == IdOf<MarkerComponent>());
+    assert(IdOf<DerivedHealthComponent>() != IdOf<HealthComponent>());
+
+    Instance inst;
+    assert(!inst.HasComponent<MarkerComponent>());
+    inst.AddComponent<MarkerComponent>(7);
+    assert(inst.GetComponent<MarkerComponent>()->value == 7);
+    assert(!inst.HasComponent<HealthComponent>());
+
+    inst.LockComponent<MarkerComponent>();
+    bool threw = false;
+    try { inst.RemoveComponent<MarkerComponent>(); } catch (const std::runtime_error&) { threw = true; }
+    assert(threw && inst.HasComponent<MarkerComponent>());
+
+    inst.AddComponent<HealthComponent>();
+    inst.RemoveComponent<HealthComponent>();
+    assert(!inst.HasComponent<HealthComponent>());
+}
+
+static void TestTagAtoms() {
+    // Names intern to one atom each; built-ins have fixed ones
+    assert(Tags::Intern("Player") == Tags::Of(BuiltinTag::Player));
+    TagId crate = Tags::Intern("Crate");
+    assert(!Tags::IsBuiltin(crate) && Tags::Intern("Crate") == crate && Tags::GetName(crate) == "Crate");
+    assert(Tags::Find("NeverInterned") == Tags::Null);
+
+    // Tags spill out of the inline array and back, keeping their order
+    Instance inst;
+    for (int i = 0; i < 8; ++i) inst.AddTag("Tag" + std::to_string(i));
+    inst.AddTag("Tag3");
+    assert(inst.GetTags().Size() == 8 && inst.HasTag("Tag7"));
+    inst.RemoveTag("Tag0");
+    inst.RemoveTag("Tag1");
+    assert(inst.GetTags().Size() == TagSet::InlineCapacity && !inst.HasTag("Tag1"));
+    assert(*inst.GetTags().begin() == Tags::Find("Tag2") && *(inst.GetTags().end() - 1) == Tags::Find("Tag7"));
+
+    // On the wire, built-in tags are their atom alone; others carry their name
+    Instance tagged;
+    tagged.AddTag(Tags::Of(BuiltinTag::Player));
+    PacketCodec codec;
+    tagged.Encode(codec);
+    size_t builtinSize = codec.Size();
+    tagged.AddTag(crate);
+    codec.Reset();
+    tagged.Encode(codec);
+    assert(codec.Size() == builtinSize + sizeof(uint16_t) + sizeof(uint32_t) + 5);
+
+    Instance decoded;
+    decoded.AddTag("Stale");
+    decoded.Decode(codec);
+    assert(decoded.GetTags().Size() == 2 && decoded.HasTag(crate) && decoded.HasTag("Player") && !decoded.HasTag("Stale"));
+}
 
 int main() {
+    TestComponentIds();
+    TestTagAtoms();
+
     PlayerEntity player;
     PlayerEntity decoded;
     PacketCodec codec;
@@ -20,7 +93,7 @@ int main() {
     player.Move(Vector2d(5, 5));
     player.SetAcceleration(Vector2d(1, 0));
     player.TakeDamage(25);
-    player.GetHitbox()->AddHitbox(std::make_unique<RectShape>(Rect2d { 0.0, 0.0, 25.0, 100.0 }, 0.0f));
+    player.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 25.0, 100.0 }, 0.0f));
     player.AddTag("Player");
 
     for (int i = 0; i < 60; ++i) player.Tick(1.0f / 60.0f);
@@ -0,0 +1,42 @@
+#include "Util/FixedTimestep.h"
+#include "Core/World/World.h"
+#include <cassert>
+
+// Fixed timestep scheduler test
+
+int main() {
+    using namespace std::chrono_literals;
+
+    // Every tick gets exactly one step, however late Advance is called
+    FixedTimestep timestep(1000.0, CatchUpPolicy::Bounded, 8);
+    std::this_thread::sleep_for(10500us);
+
+    double total = 0;
+    uint32_t ran = timestep.Advance([&](double dt) {
+        assert(dt == timestep.GetStep());
+        total += dt;
+    });
+    assert(ran == 8);
+    assert(total == 8 * timestep.GetStep());
+    assert(timestep.GetDroppedTicks() >= 2);
+    assert(timestep.GetAlpha() >= 0.0 && timestep.GetAlpha() <= 1.0);
+
+    timestep.SetCatchUpPolicy(CatchUpPolicy::Skip, 8);
+    std::this_thread::sleep_for(5ms);
+    assert(timestep.Advance([](double) {}) == 1);
+
+    timestep.WaitForNextTick();
+    assert(timestep.Advance([](double) {}) >= 1);
+    assert(timestep.GetTickCount() >= 10);
+
+    // Render positions blend from the previous tick towards the current one
+    World world(true);
+    auto& obj = world.SpawnObject<GameObject>();
+    obj.SetVelocity(Vector2d(64, 0));
+    world.Tick(0.25f);
+    assert(world.GetRenderPosition(obj, 0.0) == Vector2d(0, 0));
+    assert(world.GetRenderPosition(obj, 0.5) == Vector2d(8, 0));
+    assert(world.GetRenderPosition(obj, 1.0) == obj.GetPosition());
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "Core/JobSystem.h"
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+// Job system tests; scheduling overhead is measured in benchmarks/JobSystem.cpp
+
+static void TestParallelForCoversRange(JobSystem& jobs) {
+    for (size_t count : { 0, 1, 7, 1000, 100000 }) {
+        std::vector<int> hits(count, 0);
+        jobs.ParallelFor(count, 16, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) ++hits[i];
+        });
+        for (int h : hits) assert(h == 1);
+    }
+}
+
+static void TestDependencies(JobSystem& jobs) {
+    // a -> (b, c) -> d; each stage checks the previous one has fully finished
+    std::atomic<int> stage{0};
+    JobCounter first, second, last;
+
+    jobs.Schedule([&] { stage = 1; }, &first);
+    for (int i = 0; i < 2; ++i)
+        jobs.ScheduleAfter(first, [&] { assert(stage >= 1); stage.fetch_add(1); }, &second);
+    jobs.ScheduleAfter(second, [&] { assert(stage == 3); stage = 4; }, &last);
+
+    jobs.Wait(last);
+    assert(stage == 4 && first.IsDone() && second.IsDone());
+
+    // Scheduling after a finished counter runs right away
+    bool ran = false;
+    JobCounter again;
+    jobs.ScheduleAfter(first, [&] { ran = true; }, &again);
+    jobs.Wait(again);
+    assert(ran);
+}
+
+static void TestNestedWaits(JobSystem& jobs) {
+    // Jobs that fork and wait on their own children must not deadlock, even when
+    // there are more waiting jobs than threads
+    std::atomic<size_t> leaves{0};
+    JobCounter outer;
+    for (int i = 0; i < 32; ++i) {
+        jobs.Schedule([&] {
+            JobCounter inner;
+            for (int j = 0; j < 32; ++j)
+                jobs.Schedule([&] { leaves.fetch_add(1); }, &inner);
+            jobs.Wait(inner);
+        }, &outer);
+    }
+    jobs.Wait(outer);
+    assert(leaves == 32 * 32);
+
+    std::vector<size_t> partial(64, 0);
+    jobs.Run(partial.size(), [&](size_t chunk) {
+        jobs.ParallelFor(1000, 10, [&](size_t begin, size_t end) {
+            size_t local = 0;
+            for (size_t i = begin; i < end; ++i) local += i;
+            // Chunks of one ParallelFor run on several threads
+            static std::mutex mutex;
+            std::lock_guard<std::mutex> lock(mutex);
+            partial[chunk] += local;
+        });
+    });
+    size_t sum = std::accumulate(partial.begin(), partial.end(), size_t(0));
+    assert(sum == partial.size() * (999 * 1000 / 2));
+}
+
+int main() {
+    for (size_t threads : { 0, 1, 3 }) {
+        JobSystem jobs(threads);
+        assert(jobs.GetThreadCount() == threads + 1);
+
+        TestParallelForCoversRange(jobs);
+        TestDependencies(jobs);
+        TestNestedWaits(jobs);
+        assert(jobs.GetExecutedCount() > 0);
+    }
+
+    // Queued work is finished before the workers are joined
+    std::atomic<int> done{0};
+    {
+        JobSystem jobs(2);
+        for (int i = 0; i < 100; ++i) jobs.Schedule([&] { done.fetch_add(1); });
+    }
+    assert(done == 100);
+
+    return 0;
+}
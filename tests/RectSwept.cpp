@@ -0,0 +1,213 @@
+#include "Util/Physics/SweptAABBBatch.h"
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+// Swept shape tests: touching normals, batched sweeps against the scalar kernel, pair dispatch
+// and the polygon and circle/polygon narrowphases
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+static BatchSweepResult SweepEach(const Rect2d& a, const Vector2d& va, const RectBatch& batch, double limit) {
+    BatchSweepResult best;
+    double earliest = limit;
+    for (size_t i = 0; i < batch.Size(); ++i) {
+        SweepResult res = SweptAABB(a, va, batch.GetRect(i), batch.GetDisplacement(i), 1.0);
+        if (!res.hit || !(res.toi < earliest)) continue;
+        earliest = res.toi;
+        best = { true, res.toi, static_cast<uint32_t>(i), SweepNormalIndex(res.normal) };
+    }
+    return best;
+}
+
+static void TestTouchingNormals() {
+    // Already touching and moving into each other: the normal must oppose the motion on either side
+    SweepResult left = SweptAABB({ 0, 0, 10, 10 }, { -5, 0 }, { -10, 0, 10, 10 }, { 0, 0 }, 1.0);
+    assert(left.hit && left.toi == 0.0 && left.normal == Vector2d(1, 0));
+
+    SweepResult right = SweptAABB({ 0, 0, 10, 10 }, { 5, 0 }, { 10, 0, 10, 10 }, { 0, 0 }, 1.0);
+    assert(right.hit && right.toi == 0.0 && right.normal == Vector2d(-1, 0));
+
+    SweepResult up = SweptAABB({ 0, 0, 10, 10 }, { 0, -5 }, { 0, -10, 10, 10 }, { 0, 0 }, 1.0);
+    assert(up.hit && up.toi == 0.0 && up.normal == Vector2d(0, 1));
+
+    SweepResult down = SweptAABB({ 0, 0, 10, 10 }, { 0, 5 }, { 0, 10, 10, 10 }, { 0, 0 }, 1.0);
+    assert(down.hit && down.toi == 0.0 && down.normal == Vector2d(0, -1));
+}
+
+static void TestBatchMatchesScalar() {
+    std::mt19937 rng(1234);
+    // Integer coordinates make touching boxes and equal impact times common
+    std::uniform_int_distribution<int> coord(-40, 40), size(0, 12), speed(-30, 30), count(0, 37);
+
+    for (int round = 0; round < 4000; ++round) {
+        Rect2d a{ double(coord(rng)), double(coord(rng)), double(size(rng)), double(size(rng)) };
+        Vector2d va{ double(speed(rng)), double(speed(rng)) };
+        if (round % 5 == 0) va.x = 0;
+        if (round % 7 == 0) va.y = 0;
+
+        RectBatch batch;
+        int n = count(rng);
+        for (int i = 0; i < n; ++i) {
+            Vector2d disp = (i % 3 == 0) ? Vector2d() : Vector2d(speed(rng) / 4.0, speed(rng) / 4.0);
+            batch.Push({ double(coord(rng)), double(coord(rng)), double(size(rng)), double(size(rng)) }, disp);
+        }
+
+        for (double limit : { double(INFINITY), 1.0, 0.5 }) {
+            BatchSweepResult expected = SweepEach(a, va, batch, limit);
+            BatchSweepResult actual = SweptAABBBatch(a, va, batch, limit);
+
+            assert(actual.hit == expected.hit);
+            if (!expected.hit) continue;
+            assert(actual.toi == expected.toi);
+            assert(std::signbit(actual.toi) == std::signbit(expected.toi));
+            assert(actual.index == expected.index);
+            assert(actual.normal == expected.normal);
+        }
+    }
+
+    // Lane tails and the earliest of several hits
+    RectBatch wall;
+    for (int i = 0; i < 7; ++i) wall.Push({ 100.0 - i * 10.0, 0, 5, 50 });
+    BatchSweepResult res = SweptAABBBatch({ 0, 10, 10, 10 }, { 200, 0 }, wall);
+    assert(res.hit && res.index == 6 && res.normal == SweepNormal::NegX);
+    assert(res.toi == (40.0 - 10.0) / 200.0);
+    assert(res.GetNormal() == Vector2d(-1, 0));
+    assert(!SweptAABBBatch({ 0, 10, 10, 10 }, { 200, 0 }, wall, res.toi).hit);
+    assert(!SweptAABBBatch({ 0, 10, 10, 10 }, { 200, 0 }, RectBatch{}).hit);
+}
+
+static void TestShapePairDispatch() {
+    HitboxShape rect = RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 });
+    HitboxShape circle = CircleShape(Vector2d(5, 5), 5.0f);
+    HitboxShape square = PolygonShape({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } });
+    assert(rect.GetType() == HitboxShapeType::Rectangle && circle.Is<CircleShape>() && square.GetIf<PolygonShape>());
+
+    // Every pairing sweeps into a shape ending on top of it; none may silently miss
+    for (const HitboxShape* a : { &rect, &circle, &square }) {
+        for (const HitboxShape* b : { &rect, &circle, &square }) {
+            SweepResult res = SweptShapeCollision(*a, { 0, 0 }, { 20, 0 }, *b, { 20, 0 }, { 0, 0 }, 1.0);
+            assert(res.hit);
+        }
+    }
+
+    // Rect pairs go straight to SweptAABB
+    SweepResult direct = SweptAABB({ 0, 0, 10, 10 }, { 20, 0 }, { 15, 0, 10, 10 }, { 0, 0 }, 1.0);
+    SweepResult viaTable = SweptShapeCollision(rect, { 0, 0 }, { 20, 0 }, rect, { 15, 0 }, { 0, 0 }, 1.0);
+    assert(viaTable.hit == direct.hit && viaTable.toi == direct.toi && viaTable.normal == direct.normal);
+
+    // Circle/polygon normals point from the polygon towards the circle, and flip with the operands
+    SweepResult circleFirst = SweptShapeCollision(circle, { 0, 0 }, { 0, 0 }, square, { 8, 0 }, { 0, 0 }, 1.0);
+    assert(circleFirst.hit && circleFirst.toi == 0.0 && circleFirst.normal == Vector2d(-1, 0));
+    SweepResult polygonFirst = SweptShapeCollision(square, { 8, 0 }, { 0, 0 }, circle, { 0, 0 }, { 0, 0 }, 1.0);
+    assert(polygonFirst.hit && polygonFirst.normal == Vector2d(1, 0));
+
+    // Too far apart at both ends of the sweep
+    assert(!SweptShapeCollision(circle, { 0, 0 }, { 0, 0 }, square, { 40, 0 }, { 0, 0 }, 1.0).hit);
+    assert(!SweptShapeCollision(rect, { 0, 40 }, { 5, 0 }, square, { 0, 0 }, { 0, 0 }, 1.0).hit);
+}
+
+static void TestPolygonSweeps() {
+    PolygonShape square({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } });
+    PolygonShape triangle({ { 0, 0 }, { 10, 0 }, { 0, 10 } });
+
+    // Parallel edges share an axis; bounds and projections are cached
+    assert(square.GetAxes().size() == 2 && triangle.GetAxes().size() == 3);
+    assert(square.GetLocalBounds() == Rect2d(0, 0, 10, 10));
+
+    PacketCodec codec;
+    triangle.Encode(codec);
+    PolygonShape decoded;
+    decoded.Decode(codec);
+    assert(decoded.GetAxes().size() == 3 && decoded.GetLocalBounds() == triangle.GetLocalBounds());
+
+    HitboxShape rect = RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 });
+    HitboxShape poly = square;
+    size_t before = allocations;
+
+    // Continuous: the first touch, not a sample at the end of the sweep
+    SweepResult res = SweptPolygonSweep(square, { 0, 0 }, { 40, 0 }, square, { 20, 0 }, { 0, 0 }, 1.0);
+    assert(res.hit && res.toi == 0.25 && res.normal == Vector2d(-1, 0));
+
+    // Tunnelling through entirely between the two ends is still caught
+    res = SweptPolygonSweep(square, { 0, 0 }, { 100, 0 }, square, { 40, 0 }, { 0, 0 }, 1.0);
+    assert(res.hit && res.toi == 0.3);
+
+    // The hypotenuse's normal, pointing from b back towards a
+    res = SweptPolygonSweep(square, { 10, 10 }, { -10, -10 }, triangle, { 0, 0 }, { 0, 0 }, 1.0);
+    assert(res.hit && std::abs(res.toi - 0.5) < 1e-12);
+    assert(std::abs(res.normal.x - std::sqrt(0.5)) < 1e-12 && std::abs(res.normal.y - std::sqrt(0.5)) < 1e-12);
+
+    // Already overlapping: toi 0 along the axis of least penetration
+    res = SweptPolygonSweep(square, { 0, 0 }, { 0, 0 }, square, { 0, 8 }, { 0, 0 }, 1.0);
+    assert(res.hit && res.toi == 0.0 && res.normal == Vector2d(0, -1));
+
+    // Near miss and moving apart
+    assert(!SweptPolygonSweep(square, { 0, 11 }, { 40, 0 }, square, { 20, 0 }, { 0, 0 }, 1.0).hit);
+    assert(!SweptPolygonSweep(square, { 0, 0 }, { -40, 0 }, square, { 20, 0 }, { 0, 0 }, 1.0).hit);
+
+    // A square polygon behaves like the rectangle it outlines
+    SweepResult box = SweptShapeCollision(rect, { 0, 3 }, { 40, 0 }, rect, { 20, 0 }, { 0, 0 }, 1.0);
+    SweepResult mixed = SweptShapeCollision(rect, { 0, 3 }, { 40, 0 }, poly, { 20, 0 }, { 0, 0 }, 1.0);
+    assert(mixed.hit && mixed.toi == box.toi && mixed.normal == box.normal);
+    mixed = SweptShapeCollision(poly, { 20, 0 }, { 0, 0 }, rect, { 0, 3 }, { 40, 0 }, 1.0);
+    assert(mixed.hit && mixed.toi == box.toi && mixed.normal == -box.normal);
+
+    assert(allocations == before);
+}
+
+static void TestCirclePolygonSweeps() {
+    CircleShape ball(Vector2d(0, 0), 2.0f);
+    PolygonShape wall({ { 0, -20 }, { 4, -20 }, { 4, 20 }, { 0, 20 } });
+    PolygonShape diamond({ { 0, -10 }, { 10, 0 }, { 0, 10 }, { -10, 0 } });
+
+    // A thin wall the ball passes entirely through within one sweep
+    SweepResult res = SweptCirclePolygon(ball, { 0, 0 }, { 100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0);
+    assert(res.hit && std::abs(res.toi - 0.38) < 1e-12 && res.normal == Vector2d(-1, 0));
+    // ...and from the other side, or with the wall doing the moving
+    res = SweptCirclePolygon(ball, { 100, 0 }, { -100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0);
+    assert(res.hit && std::abs(res.toi - 0.54) < 1e-12 && res.normal == Vector2d(1, 0));
+    res = SweptCirclePolygon(ball, { 0, 0 }, { 0, 0 }, wall, { 40, 0 }, { -100, 0 }, 1.0);
+    assert(res.hit && std::abs(res.toi - 0.38) < 1e-12 && res.normal == Vector2d(-1, 0));
+
+    // Grazing the wall's corner: the hit is on the arc around it
+    res = SweptCirclePolygon(ball, { 0, 21 }, { 100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0);
+    double x = 40.0 - std::sqrt(3.0);
+    assert(res.hit && std::abs(res.toi - x / 100.0) < 1e-12);
+    assert(std::abs(res.normal.x + std::sqrt(3.0) / 2.0) < 1e-12 && std::abs(res.normal.y - 0.5) < 1e-12);
+    assert(!SweptCirclePolygon(ball, { 0, 22.5 }, { 100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0).hit);
+
+    // A slanted edge, through the operand-swapping dispatch too
+    res = SweptCirclePolygon(ball, { 20, 20 }, { -20, -20 }, diamond, { 0, 0 }, { 0, 0 }, 1.0);
+    double toi = (20.0 - 5.0 - std::sqrt(2.0)) / 20.0;
+    assert(res.hit && std::abs(res.toi - toi) < 1e-12);
+    assert(std::abs(res.normal.x - std::sqrt(0.5)) < 1e-12 && std::abs(res.normal.y - std::sqrt(0.5)) < 1e-12);
+    SweepResult swapped = SweptShapeCollision(HitboxShape(diamond), { 0, 0 }, { 0, 0 },
+                                              HitboxShape(ball), { 20, 20 }, { -20, -20 }, 1.0);
+    assert(swapped.hit && swapped.toi == res.toi && swapped.normal == -res.normal);
+
+    // Moving away, falling short, and passing alongside
+    assert(!SweptCirclePolygon(ball, { 0, 0 }, { -100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0).hit);
+    assert(!SweptCirclePolygon(ball, { 0, 0 }, { 30, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0).hit);
+    assert(!SweptCirclePolygon(ball, { 0, 30 }, { 100, 0 }, wall, { 40, 0 }, { 0, 0 }, 1.0).hit);
+}
+
+int main() {
+    TestTouchingNormals();
+    TestBatchMatchesScalar();
+    TestShapePairDispatch();
+    TestPolygonSweeps();
+    TestCirclePolygonSweeps();
+    return 0;
+}
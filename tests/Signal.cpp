@@ -0,0 +1,99 @@
+#include "Core/Connection.h"
+#include <array>
+#include <cassert>
+#include <memory>
+#include <string>
+
+// Signal tests; Fire timings are in benchmarks/Signal.cpp
+
+struct CopyCounter {
+    static inline int copies = 0;
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter&) { ++copies; }
+};
+
+static void TestConnections() {
+    Signal<int> signal;
+    int sum = 0;
+
+    {
+        Connection scoped = signal.Connect([&](int v) { sum += v; });
+        signal.Fire(1);
+    }
+    signal.Fire(10); // scoped went out of scope
+    assert(sum == 1);
+
+    signal.ConnectPersistent([&](int v) { sum += v * 100; });
+    signal.ConnectOncePersistent([&](int v) { sum += v * 1000; });
+    signal.Fire(1);
+    signal.Fire(2);
+    assert(sum == 1 + 100 + 1000 + 200);
+
+    signal.DisconnectAll();
+    assert(!signal.HasListeners());
+    signal.Fire(5);
+    assert(sum == 1301);
+
+    // Connections may outlive their signal
+    Connection orphan;
+    {
+        Signal<> inner;
+        orphan = inner.Connect([] {});
+    }
+    orphan.Disconnect();
+}
+
+static void TestArgumentsAreNotCopied() {
+    Signal<CopyCounter> signal;
+    int calls = 0;
+    signal.ConnectPersistent([&](const CopyCounter&) { ++calls; });
+    signal.ConnectPersistent([&](const CopyCounter&) { ++calls; });
+
+    CopyCounter value;
+    CopyCounter::copies = 0;
+    signal.Fire(value);
+    assert(calls == 2 && CopyCounter::copies == 0);
+
+    // Captures too large to store inline still work
+    std::array<double, 16> big{};
+    big[15] = 3.0;
+    Signal<std::string> named;
+    std::string seen;
+    named.ConnectPersistent([big, &seen](const std::string& s) { seen = s + std::to_string(int(big[15])); });
+    named.Fire("x");
+    assert(seen == "x3");
+}
+
+static void TestChangesDuringFire() {
+    Signal<> signal;
+    std::string order;
+
+    // Disconnecting a later listener skips it at once; one connected while
+    // firing is first called by the next Fire
+    Connection b;
+    signal.ConnectPersistent([&] {
+        order += 'a';
+        b.Disconnect();
+        signal.ConnectOncePersistent([&] { order += 'c'; });
+    });
+    b = signal.Connect([&] { order += 'b'; });
+    signal.Fire();
+    assert(order == "a");
+    signal.Fire();
+    assert(order == "aac");
+
+    // A listener may destroy the signal it is called from; later listeners are skipped
+    auto owned = std::make_unique<Signal<int>>();
+    int after = 0;
+    owned->ConnectPersistent([&](int) { owned.reset(); });
+    owned->ConnectPersistent([&](int) { ++after; });
+    owned->Fire(1);
+    assert(!owned && after == 0);
+}
+
+int main() {
+    TestConnections();
+    TestArgumentsAreNotCopied();
+    TestChangesDuringFire();
+    return 0;
+}
@@ -1,18 +1,1102 @@
 #include "Core/Components/Component.h"
 #include "Core/Objects/PlayerEntity.h"
 #include "Common/Network/PacketCodec.h"
+#include "Common/Packets/S2C/ReplicationPacket.h"
 #include "Core/Components/ComponentRegistry.h"
 #include "Core/World/World.h"
+#include "Core/World/ShardedWorld.h"
+#include "Core/World/DynamicAABBTree.h"
+#include "Core/World/SpatialHashGrid.h"
+#include <atomic>
 #include <cassert>
+#include <random>
+#include <thread>
 
 // World test
 
+// A body moving into an anchored wall must stop at the wall instead of tunnelling
+static void TestWallStopsBody(BroadphaseType type, SolverMode solver) {
+    World world(true);
+    PhysicsSettings settings;
+    settings.broadphase = type;
+    settings.solver = solver;
+    world.SetPhysicsSettings(settings);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(100, 0));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(0, 40));
+    box.SetVelocity(Vector2d(500, 0));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    // A far-away body that must not be affected by (or affect) the contact
+    auto& bystander = world.SpawnObject<GameObject>();
+    bystander.SetPosition(Vector2d(5000, 5000));
+    bystander.SetVelocity(Vector2d(0, 64));
+    bystander.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    for (int i = 0; i < 64; ++i) world.Tick(1.0f / 64.0f);
+
+    assert(box.GetPosition().x + 10.0 <= 100.0 + 1e-3);
+    assert(wall.GetPosition() == Vector2d(100, 0));
+    assert(std::abs(bystander.GetPosition().y - 5064.0) < 1e-3);
+}
+
+// Anchored walls live in the static layer, which must follow them when they move or un-anchor
+static void TestStaticLayerTracksWalls() {
+    World world(true);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+    wall.SetPosition(Vector2d(1000, 0));
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(0, 40));
+    box.SetVelocity(Vector2d(640, 0));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetStaticLayer().Size() == 1);
+    assert(box.GetBroadphaseProxy() != IBroadphase::NullProxy);
+    assert(wall.GetBroadphaseProxy() == IBroadphase::NullProxy);
+
+    // Teleport the wall into the box's path
+    wall.SetPosition(Vector2d(50, 0));
+    for (int i = 0; i < 16; ++i) world.Tick(1.0f / 64.0f);
+    assert(box.GetPosition().x + 10.0 <= 50.0 + 1e-2); // contacts at t=0 still advance MIN_STEP first
+
+    // Un-anchored walls leave the static layer and join the broadphase
+    wall.GetPhysicalProperties()->SetAnchored(false);
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetStaticLayer().Size() == 0);
+    assert(wall.GetBroadphaseProxy() != IBroadphase::NullProxy);
+}
+
+// The tree keeps pairs between queries; they must stay exact as proxies move,
+// leave and come back under reused ids
+static void TestTreePairsStayCurrent() {
+    SpatialHashGrid grid(16.0);
+    DynamicAABBTree tree(2.0);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coord(0, 200), size(1, 30), step(-6, 6);
+    std::uniform_int_distribution<int> action(0, 9);
+
+    struct Proxy { IBroadphase::ProxyId grid, tree; Rect2d box; };
+    std::vector<Proxy> live;
+    std::vector<IBroadphase::ProxyPair> gridPairs, treePairs;
+
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            int a = action(rng);
+            if (a < 3 || live.size() < 4) {
+                Rect2d box{ coord(rng), coord(rng), size(rng), size(rng) };
+                live.push_back({ grid.CreateProxy(box, nullptr), tree.CreateProxy(box, nullptr), box });
+            } else if (a < 5) {
+                size_t k = rng() % live.size();
+                grid.DestroyProxy(live[k].grid);
+                tree.DestroyProxy(live[k].tree);
+                live.erase(live.begin() + k);
+            }
+        }
+        for (auto& p : live) {
+            p.box = p.box.Translated(Vector2d(step(rng), step(rng)));
+            grid.MoveProxy(p.grid, p.box);
+            tree.MoveProxy(p.tree, p.box);
+        }
+
+        // Compare as pairs of positions in `live`
+        auto byLive = [&](const std::vector<IBroadphase::ProxyPair>& pairs, bool fromTree) {
+            std::vector<std::pair<size_t, size_t>> out;
+            auto index = [&](IBroadphase::ProxyId id) {
+                for (size_t k = 0; k < live.size(); ++k)
+                    if ((fromTree ? live[k].tree : live[k].grid) == id) return k;
+                assert(false);
+                return size_t(0);
+            };
+            for (auto [a, b] : pairs) out.emplace_back(std::min(index(a), index(b)), std::max(index(a), index(b)));
+            std::sort(out.begin(), out.end());
+            return out;
+        };
+
+        gridPairs.clear();
+        treePairs.clear();
+        grid.QueryPairs(gridPairs);
+        tree.QueryPairs(treePairs);
+        assert(std::is_sorted(treePairs.begin(), treePairs.end()));
+        assert(byLive(gridPairs, false) == byLive(treePairs, true));
+    }
+}
+
+// Both broadphases must report the same pairs and query hits for the same scene
+static void TestBroadphaseQueries() {
+    SpatialHashGrid grid(16.0);
+    DynamicAABBTree tree(2.0);
+    std::vector<Rect2d> boxes = {
+        { 0, 0, 10, 10 }, { 5, 5, 10, 10 }, { 100, 0, 10, 10 },
+        { -500, 40, 1000, 4 }, { 30, 30, 2, 2 }, { 31, 31, 2, 2 }
+    };
+    std::vector<IBroadphase::ProxyId> gridIds, treeIds;
+    for (const auto& box : boxes) {
+        gridIds.push_back(grid.CreateProxy(box, nullptr));
+        treeIds.push_back(tree.CreateProxy(box, nullptr));
+    }
+
+    // Proxy ids are structure specific; compare results as box indices
+    auto toBoxes = [](const std::vector<IBroadphase::ProxyId>& ids, std::vector<IBroadphase::ProxyId> hits) {
+        for (auto& h : hits) h = static_cast<IBroadphase::ProxyId>(std::find(ids.begin(), ids.end(), h) - ids.begin());
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    };
+    auto pairsToBoxes = [](const std::vector<IBroadphase::ProxyId>& ids, const std::vector<IBroadphase::ProxyPair>& pairs) {
+        std::vector<IBroadphase::ProxyPair> out;
+        for (auto [a, b] : pairs) {
+            auto ia = static_cast<IBroadphase::ProxyId>(std::find(ids.begin(), ids.end(), a) - ids.begin());
+            auto ib = static_cast<IBroadphase::ProxyId>(std::find(ids.begin(), ids.end(), b) - ids.begin());
+            out.emplace_back(std::min(ia, ib), std::max(ia, ib));
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+
+    // Move one box far away, and one within the tree's fat margin
+    grid.MoveProxy(gridIds[2], { 300, 300, 10, 10 });
+    tree.MoveProxy(treeIds[2], { 300, 300, 10, 10 });
+    grid.MoveProxy(gridIds[4], { 30.5, 30, 2, 2 });
+    tree.MoveProxy(treeIds[4], { 30.5, 30, 2, 2 });
+
+    std::vector<IBroadphase::ProxyPair> gridPairs, treePairs;
+    grid.QueryPairs(gridPairs);
+    tree.QueryPairs(treePairs);
+    assert(std::is_sorted(gridPairs.begin(), gridPairs.end()));
+    assert(std::is_sorted(treePairs.begin(), treePairs.end()));
+    assert(pairsToBoxes(gridIds, gridPairs) == pairsToBoxes(treeIds, treePairs));
+    assert(pairsToBoxes(gridIds, gridPairs) == std::vector<IBroadphase::ProxyPair>({ { 0, 1 }, { 4, 5 } }));
+
+    std::vector<IBroadphase::ProxyId> gridHits, treeHits;
+    grid.QueryRegion({ 8, 8, 30, 30 }, gridHits);
+    tree.QueryRegion({ 8, 8, 30, 30 }, treeHits);
+    assert(toBoxes(gridIds, gridHits) == toBoxes(treeIds, treeHits));
+    assert(gridHits.size() == 4);
+
+    gridHits.clear();
+    treeHits.clear();
+    Vector2d origin(-10, -10);
+    Vector2d dir = Vector2d(1, 1).Normalized();
+    grid.QueryRay(origin, dir, 100.0, gridHits);
+    tree.QueryRay(origin, dir, 100.0, treeHits);
+    assert(toBoxes(gridIds, gridHits) == toBoxes(treeIds, treeHits));
+    assert(toBoxes(gridIds, gridHits) == std::vector<IBroadphase::ProxyId>({ 0, 1, 3, 4, 5 }));
+}
+
+// Sweeping pairs on worker threads must pick exactly the contacts the tick thread would
+static void TestParallelNarrowphaseMatchesSerial(SolverMode solver) {
+    auto run = [solver](unsigned threads) {
+        World world(true);
+        PhysicsSettings settings;
+        settings.solver = solver;
+        settings.narrowphaseThreads = threads;
+        settings.parallelPairThreshold = 1;
+        world.SetPhysicsSettings(settings);
+
+        std::vector<GameObject*> bodies;
+        for (int i = 0; i < 64; ++i) {
+            auto& obj = world.SpawnObject<GameObject>();
+            obj.SetPosition(Vector2d((i % 8) * 24.0, (i / 8) * 24.0));
+            obj.SetVelocity(Vector2d(((i * 37) % 11) * 40.0 - 200.0, ((i * 53) % 13) * 30.0 - 180.0));
+            obj.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 12.0, 12.0 }));
+            bodies.push_back(&obj);
+        }
+
+        for (int i = 0; i < 32; ++i) world.Tick(1.0f / 64.0f);
+
+        std::vector<Vector2d> positions;
+        for (auto* obj : bodies) positions.push_back(obj->GetPosition());
+        return positions;
+    };
+
+    auto serial = run(0);
+    assert(serial == run(3));
+}
+
+// Transforms read through the world's body store, and keep their state when the store lets go of them
+static void TestBodyStoreBinding() {
+    World world(true);
+
+    auto& first = world.SpawnObject<GameObject>();
+    auto& second = world.SpawnObject<GameObject>();
+    first.SetPosition(Vector2d(1, 2));
+    second.SetVelocity(Vector2d(3, 4));
+    second.GetPhysicalProperties()->SetMass(4.0f);
+    assert(world.GetBodies().Size() == 2);
+    assert(world.GetBodies().GetPosition(first.GetPhysicsBody()) == Vector2d(1, 2));
+    assert(world.GetBodies().GetInverseMass(second.GetPhysicsBody()) == 0.25f);
+
+    // Removing the first body moves the second into its slot
+    std::unique_ptr<GameObject> detached = std::make_unique<GameObject>();
+    detached->SetPosition(Vector2d(7, 7));
+    UUID id = world.AddObject(std::move(detached));
+    GameObject* added = world.Find(id);
+    assert(added->GetPosition() == Vector2d(7, 7));
+
+    world.RemoveObject(&first);
+    assert(world.GetBodies().Size() == 2);
+    assert(second.GetVelocity() == Vector2d(3, 4));
+    assert(added->GetPosition() == Vector2d(7, 7));
+    assert(world.GetBodies().GetObject(second.GetPhysicsBody()) == &second);
+
+    world.Tick(0.5f);
+    assert(second.GetPosition() == Vector2d(1.5, 2));
+}
+
+// Idle bodies fall asleep, and wake when hit or when their velocity is set
+static void TestSleepingBodies() {
+    World world(true);
+    PhysicsSettings settings;
+    settings.sleepTicks = 4;
+    world.SetPhysicsSettings(settings);
+
+    auto& resting = world.SpawnObject<GameObject>();
+    resting.SetPosition(Vector2d(100, 0));
+    resting.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    auto& idle = world.SpawnObject<GameObject>();
+    idle.SetPosition(Vector2d(5000, 0));
+    idle.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    for (int i = 0; i < 4; ++i) world.Tick(1.0f / 64.0f);
+    assert(resting.IsSleeping() && idle.IsSleeping());
+    assert(world.GetSleepingBodyCount() == 2 && world.GetAwakeBodyCount() == 0);
+
+    idle.SetVelocity(Vector2d(64, 0));
+    assert(!idle.IsSleeping());
+
+    auto& mover = world.SpawnObject<GameObject>();
+    mover.SetPosition(Vector2d(200, 0));
+    mover.SetVelocity(Vector2d(-640, 0));
+    mover.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetSleepingBodyCount() == 1 && world.GetAwakeBodyCount() == 2);
+    assert(idle.GetPosition().x == 5001.0);
+
+    // The mover reaches the sleeping body within a few ticks and must not pass through it
+    for (int i = 0; i < 16; ++i) world.Tick(1.0f / 64.0f);
+    assert(mover.GetPosition().x >= resting.GetPosition().x + 10.0 - 1e-2);
+    assert(resting.GetPosition().x < 100.0);
+}
+
+// Bodies pushed into a wall every tick keep their contacts in the cache; with warm starting
+// the resting contacts are solved before the sweep, so it no longer needs a pass for them
+static void TestWarmStartedContacts(bool warmStarting) {
+    World world(true);
+    PhysicsSettings settings;
+    settings.warmStarting = warmStarting;
+    settings.sleepTicks = 0;
+    world.SetPhysicsSettings(settings);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(-20, -500));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 20.0, 1000.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    // Side by side, so all three reach the wall in the same step
+    std::vector<GameObject*> boxes;
+    for (int i = 0; i < 3; ++i) {
+        auto& box = world.SpawnObject<GameObject>();
+        box.SetPosition(Vector2d(5, i * 12.0));
+        box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+        boxes.push_back(&box);
+    }
+
+    for (int i = 0; i < 32; ++i) {
+        for (auto* box : boxes) box->SetAcceleration(Vector2d(-200, 0));
+        world.Tick(1.0f / 64.0f);
+    }
+
+    for (auto* box : boxes) assert(box->GetPosition().x >= 0.0);
+    if (warmStarting) {
+        assert(world.GetContactCache().Size() == 3);
+        assert(world.GetNarrowphasePassCount() == 1);
+        const ContactCache::Entry* entry = world.GetContactCache().Find(wall.GetHandle(), boxes[0]->GetHandle(), 0, 0);
+        assert(entry && entry->warmImpulse > 0.0);
+    } else {
+        assert(world.GetContactCache().Size() == 0);
+        assert(world.GetNarrowphasePassCount() >= 2);
+    }
+
+    // A removed body's contacts are left to expire, and never match what reuses its slot
+    ObjectHandle removed = boxes[0]->GetHandle();
+    world.RemoveObject(boxes[0]);
+    auto& reused = world.SpawnObject<GameObject>();
+    assert(reused.GetHandle().index == removed.index);
+    assert(!world.GetContactCache().Find(wall.GetHandle(), reused.GetHandle(), 0, 0));
+    for (uint32_t i = 0; i <= world.GetPhysicsSettings().contactExpiryTicks; ++i) {
+        for (size_t k = 1; k < boxes.size(); ++k) boxes[k]->SetAcceleration(Vector2d(-200, 0));
+        world.Tick(1.0f / 64.0f);
+    }
+    assert(world.GetContactCache().Size() == (warmStarting ? 2u : 0u));
+}
+
+// Cached world bounds follow the object as it moves, is swept and changes hitboxes
+static void TestCachedBounds() {
+    World world(true);
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(10, 20));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    assert(box.GetWorldBounds() == Rect2d(10, 20, 10, 10));
+
+    box.GetHitbox()->AddHitbox(CircleShape(Vector2d(20, 5), 5.0f));
+    assert(box.GetWorldBounds() == Rect2d(10, 20, 25, 10));
+
+    box.Move(Vector2d(5, 0));
+    assert(box.GetWorldBounds() == Rect2d(15, 20, 25, 10));
+    assert(world.GetBodies().GetAllBounds()[box.GetPhysicsBody()] == box.GetWorldBounds());
+
+    // One tick at 64 units/s moves it 1 unit; between ticks the broadphase is refit
+    // without a horizon, so the swept bounds are the plain bounds again
+    box.SetVelocity(Vector2d(64, 0));
+    world.Tick(1.0f / 64.0f);
+    assert(box.GetWorldBounds() == Rect2d(16, 20, 25, 10));
+    assert(box.GetSweptBounds() == box.GetWorldBounds());
+
+    // Outside a world the bounds are computed from the transform
+    world.RemoveObject(&box);
+    GameObject loose;
+    loose.SetPosition(Vector2d(-5, -5));
+    loose.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    assert(loose.GetWorldBounds() == Rect2d(-5, -5, 10, 10) && loose.GetSweptBounds() == loose.GetWorldBounds());
+}
+
+// Runs a two-region scene: a box crossing into the other region towards a wall, and
+// two boxes meeting head-on across the border. Returns the final positions.
+static std::vector<Vector2d> RunShardedScene(unsigned threads) {
+    ShardSettings settings;
+    settings.regionSize = 100.0;
+    settings.columns = 2;
+    settings.rows = 1;
+    settings.haloWidth = 16.0;
+    settings.threads = threads;
+    ShardedWorld world(true, settings);
+
+    auto& wall = world.SpawnObject<GameObject>(Vector2d(150, -50));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& runner = world.SpawnObject<GameObject>(Vector2d(40, -30));
+    runner.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    runner.SetVelocity(Vector2d(320, 0));
+
+    auto& left = world.SpawnObject<GameObject>(Vector2d(80, 20));
+    left.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    left.SetVelocity(Vector2d(64, 0));
+
+    auto& right = world.SpawnObject<GameObject>(Vector2d(110, 20));
+    right.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    right.SetVelocity(Vector2d(-64, 0));
+
+    assert(world.GetOwnerRegion(runner) == 0 && world.GetOwnerRegion(wall) == 1);
+    assert(world.GetObjectCount() == 4);
+
+    size_t migrations = 0, maxGhosts = 0;
+    for (int i = 0; i < 64; ++i) {
+        world.Tick(1.0f / 64.0f);
+        migrations += world.GetMigrationCount();
+        maxGhosts = std::max(maxGhosts, world.GetGhostCount());
+    }
+
+    // The runner changed owner and the wall in the other region still stopped it
+    assert(migrations >= 1 && world.GetOwnerRegion(runner) == 1);
+    assert(runner.GetWorld() == &world.GetRegion(1));
+    assert(runner.GetPosition().x + 10.0 <= 150.0 + 1e-2);
+
+    // Each saw the other through its ghost, so they did not pass through each other
+    assert(maxGhosts >= 2);
+    assert(left.GetPosition().x + 10.0 <= right.GetPosition().x + 1e-3);
+
+    size_t objects = 0;
+    world.ForEachObject([&](GameObject& obj) { ++objects; assert(!world.IsGhost(&obj)); });
+    assert(objects == 4 && world.GetObjectCount() == 4);
+
+    std::vector<Vector2d> positions{ runner.GetPosition(), left.GetPosition(), right.GetPosition() };
+
+    // Removing an object takes its ghosts with it
+    world.RemoveObject(&wall);
+    assert(world.GetObjectCount() == 3);
+    for (size_t i = 0; i < world.GetRegionCount(); ++i)
+        for (const auto& obj : world.GetRegion(i).GetObjects())
+            assert(!obj->IsAnchored());
+
+    return positions;
+}
+
+static void TestShardedWorld() {
+    // Regions never share state while ticking, so threads cannot change the outcome
+    assert(RunShardedScene(0) == RunShardedScene(2));
+
+    ShardSettings bad;
+    bad.columns = 0;
+    bool threw = false;
+    try { ShardedWorld world(true, bad); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+}
+
+// A wall owned by region 1 reaches into region 0, where a box hits its ghost
+// without getting near region 1 itself
+static void TestShardedGhostCollisions() {
+    ShardSettings settings;
+    settings.regionSize = 100.0;
+    settings.columns = 2;
+    settings.rows = 1;
+    settings.haloWidth = 16.0;
+    ShardedWorld world(true, settings);
+
+    auto& wall = world.SpawnObject<GameObject>(Vector2d(70, -50));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 200.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& runner = world.SpawnObject<GameObject>(Vector2d(20, -5));
+    runner.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    runner.SetVelocity(Vector2d(320, 0));
+    assert(world.GetOwnerRegion(wall) == 1 && world.GetOwnerRegion(runner) == 0);
+
+    int runnerHits = 0, wallHits = 0;
+    runner.Collided.ConnectPersistent([&](GameObject* other) { assert(other == &wall); ++runnerHits; });
+    wall.Collided.ConnectPersistent([&](GameObject* other) { assert(other == &runner); ++wallHits; });
+
+    int ticks = 0;
+    for (; ticks < 16; ++ticks) {
+        int before = runnerHits;
+        world.Tick(1.0f / 64.0f);
+        // Once per pair and tick, on both sides, and never with a ghost
+        assert(runnerHits - before <= 1 && wallHits == runnerHits);
+        if (runnerHits) break;
+    }
+    assert(runnerHits == 1 && world.GetGhostCount() == 1);
+    assert(runner.GetPosition().x + 10.0 <= 70.0 + 1e-2);
+}
+
+// Ghosts pick up hitbox and mass changes their source makes after they exist
+static void TestShardedGhostRefresh() {
+    ShardSettings settings;
+    settings.regionSize = 100.0;
+    settings.columns = 2;
+    settings.rows = 1;
+    settings.haloWidth = 16.0;
+    ShardedWorld world(true, settings);
+
+    auto& block = world.SpawnObject<GameObject>(Vector2d(105, 0));
+    block.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    block.GetPhysicalProperties()->SetMass(2.0f);
+
+    auto findGhost = [&]() -> GameObject* {
+        for (const auto& obj : world.GetRegion(0).GetObjects())
+            if (world.IsGhost(obj.get())) return obj.get();
+        return nullptr;
+    };
+
+    world.Tick(1.0f / 64.0f);
+    GameObject* ghost = findGhost();
+    assert(ghost && ghost->GetHitbox()->GetLocalBounds() == block.GetHitbox()->GetLocalBounds());
+    assert(ghost->GetPhysicalProperties()->GetMass() == 2.0f);
+
+    block.GetHitbox()->ClearHitboxes();
+    block.GetHitbox()->AddHitbox(RectShape(Rect2d { -20.0, 0.0, 30.0, 20.0 }), CollisionGroup::DefaultCollidable, true);
+    block.GetPhysicalProperties()->SetMass(5.0f);
+    world.Tick(1.0f / 64.0f);
+
+    assert(findGhost() == ghost && world.GetGhostCount() == 1);
+    assert(ghost->GetHitbox()->GetLocalBounds() == block.GetHitbox()->GetLocalBounds());
+    assert(ghost->GetHitbox()->GetHitboxes().size() == 1 && ghost->GetHitbox()->GetHitboxes()[0].isTrigger);
+    assert(ghost->GetPhysicalProperties()->GetMass() == 5.0f);
+}
+
+// An object marking itself dirty as it moves is replicated once per collection,
+// including across a migration to another region
+static void TestShardedReplication() {
+    ShardSettings settings;
+    settings.regionSize = 100.0;
+    settings.columns = 2;
+    settings.rows = 1;
+    ShardedWorld world(true, settings);
+
+    auto& mover = world.SpawnObject<GameObject>(Vector2d(80, 0));
+    mover.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    mover.SetVelocity(Vector2d(640, 0));
+    mover.Moved.ConnectPersistent([&](Vector2d) { mover.SetDirty(); });
+
+    auto collect = [&] {
+        ReplicationPacket packet;
+        world.CollectReplication(packet);
+        return packet.GetObjects().size() == 1 && packet.GetObjects()[0].uuid == mover.GetUUID();
+    };
+
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetOwnerRegion(mover) == 0 && collect() && !mover.IsDirty());
+
+    // Queued in region 0, then migrates to region 1 before anything is collected
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetOwnerRegion(mover) == 1);
+    mover.SetVelocity(Vector2d(0, 0));
+    world.Tick(1.0f / 64.0f);
+    assert(world.GetMigrationCount() == 1 && collect());
+
+    ReplicationPacket idle;
+    world.CollectReplication(idle);
+    assert(idle.GetObjects().empty());
+}
+
+// Groups the collision matrix keeps apart must pass through each other
+static void TestCollisionFiltering() {
+    assert(CollisionMatrix::ShouldCollide(CollisionGroup::Player, CollisionGroup::Projectile));
+    assert(!CollisionMatrix::ShouldCollide(CollisionGroup::DefaultNonCollidable, CollisionGroup::Player));
+
+    CollisionMatrix::Set(CollisionGroup::Player, CollisionGroup::Projectile, false);
+    assert(!CollisionMatrix::ShouldCollide(CollisionGroup::Projectile, CollisionGroup::Player));
+
+    World world(true);
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(100, 0));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 100.0 }), CollisionGroup::Player);
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& bullet = world.SpawnObject<GameObject>();
+    bullet.SetPosition(Vector2d(0, 40));
+    bullet.SetVelocity(Vector2d(640, 0));
+    bullet.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 2.0, 2.0 }), CollisionGroup::Projectile);
+
+    auto& ghost = world.SpawnObject<GameObject>();
+    ghost.SetPosition(Vector2d(0, 60));
+    ghost.SetVelocity(Vector2d(640, 0));
+    ghost.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 2.0, 2.0 }), CollisionGroup::DefaultNonCollidable);
+
+    auto& crate = world.SpawnObject<GameObject>();
+    crate.SetPosition(Vector2d(0, 80));
+    crate.SetVelocity(Vector2d(640, 0));
+    crate.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 2.0, 2.0 }));
+
+    for (int i = 0; i < 32; ++i) world.Tick(1.0f / 64.0f);
+    assert(bullet.GetPosition().x > 110.0);
+    assert(ghost.GetPosition().x > 110.0);
+    assert(crate.GetPosition().x < 100.0);
+
+    CollisionMatrix::Reset();
+}
+
+// Queries from another thread while the world ticks, spawns and removes objects
+static void TestQueriesDuringTick() {
+    World world(true);
+    PhysicsSettings settings;
+    settings.broadphase = BroadphaseType::AABBTree;
+    world.SetPhysicsSettings(settings);
+
+    // Hitboxes go on before the object joins the world, as queries may already be reading it
+    auto makeBox = [](const Vector2d& pos, const Vector2d& vel) {
+        auto obj = std::make_unique<GameObject>();
+        obj->GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+        obj->SetPosition(pos);
+        obj->SetVelocity(vel);
+        return obj;
+    };
+
+    auto wall = std::make_unique<GameObject>();
+    wall->GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 400.0 }));
+    wall->GetPhysicalProperties()->SetAnchored(true);
+    wall->SetPosition(Vector2d(300, -200));
+    GameObject* wallPtr = wall.get();
+    world.AddObject(std::move(wall));
+    for (int i = 0; i < 32; ++i)
+        world.AddObject(makeBox(Vector2d(i * 8.0, i * 12.0 - 200.0), Vector2d(64, 0)));
+    world.Tick(1.0f / 64.0f);
+
+    std::atomic<bool> done = false;
+    std::atomic<size_t> wallHits = 0;
+    std::thread reader([&]() {
+        std::vector<GameObject*> found;
+        RaycastHit hit;
+        while (!done) {
+            // Nothing moves the wall or comes between it and this ray
+            if (world.Raycast(Vector2d(400, 190), Vector2d(-1, 0), INFINITY, hit) && hit.object == wallPtr) ++wallHits;
+            found.clear();
+            world.OverlapAABB(Rect2d { 0.0, -200.0, 400.0, 400.0 }, found);
+        }
+    });
+
+    std::vector<GameObject*> spawned;
+    for (int i = 0; i < 128; ++i) {
+        auto obj = makeBox(Vector2d(0, i - 64.0), Vector2d(32, 0));
+        spawned.push_back(obj.get());
+        world.AddObject(std::move(obj));
+        if (i % 3 == 0) {
+            world.RemoveObject(spawned.front());
+            spawned.erase(spawned.begin());
+        }
+        world.Tick(1.0f / 64.0f);
+    }
+    done = true;
+    reader.join();
+    assert(wallHits > 0);
+}
+
+// Scene queries must find the nearest matching hitbox through both the broadphase and the static layer
+static void TestSceneQueries() {
+    World world(true);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(100, -50));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& ball = world.SpawnObject<GameObject>();
+    ball.SetPosition(Vector2d(50, 0));
+    ball.GetHitbox()->AddHitbox(CircleShape(Vector2d(0, 0), 5.0f));
+
+    auto& trigger = world.SpawnObject<GameObject>();
+    trigger.SetPosition(Vector2d(20, -5));
+    trigger.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }), CollisionGroup::DefaultCollidable, true);
+
+    auto& ghost = world.SpawnObject<GameObject>();
+    ghost.SetPosition(Vector2d(30, -5));
+    ghost.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }), CollisionGroup::DefaultNonCollidable);
+
+    world.Tick(1.0f / 64.0f);
+
+    RaycastHit hit;
+    assert(world.Raycast(Vector2d(0, 0), Vector2d(2, 0), 1000.0, hit));
+    assert(hit.object == &ball);
+    assert(std::abs(hit.distance - 45.0) < 1e-9 && hit.normal == Vector2d(-1, 0));
+
+    QueryFilter skipBall;
+    skipBall.ignore = &ball;
+    assert(world.Raycast(Vector2d(0, 0), Vector2d(1, 0), 1000.0, hit, skipBall));
+    assert(hit.object == &wall && hit.distance == 100.0 && hit.normal == Vector2d(-1, 0));
+
+    QueryFilter triggers;
+    triggers.includeTriggers = true;
+    assert(world.Raycast(Vector2d(0, 0), Vector2d(1, 0), 1000.0, hit, triggers) && hit.object == &trigger);
+    assert(!world.Raycast(Vector2d(0, 0), Vector2d(1, 0), 40.0, hit));
+    assert(!world.Raycast(Vector2d(0, 0), Vector2d(-1, 0), 1000.0, hit) && hit.object == nullptr);
+
+    std::vector<Ray> rays = { { Vector2d(0, 0), Vector2d(1, 0), 1000.0 }, { Vector2d(0, 80), Vector2d(1, 0), 1000.0 },
+                              { Vector2d(105, 200), Vector2d(0, -1), 1000.0 } };
+    std::vector<RaycastHit> hits;
+    assert(world.RaycastBatch(rays, hits) == 2);
+    assert(hits[0].object == &ball && hits[1].object == nullptr && hits[2].object == &wall && hits[2].distance == 150.0);
+
+    RectShape box(Rect2d { -2.0, -2.0, 4.0, 4.0 });
+    assert(world.ShapeCast(box, Vector2d(60, 0), Vector2d(100, 0), hit));
+    assert(hit.object == &wall && std::abs(hit.point.x - 98.0) < 1e-9);
+
+    std::vector<GameObject*> found;
+    assert(world.OverlapAABB(Rect2d { 0.0, -10.0, 200.0, 20.0 }, found) == 2);
+    assert(world.OverlapCircle(Vector2d(50, 12), 8.0, found) == 1 && found.back() == &ball);
+    assert(world.OverlapCircle(Vector2d(50, 14), 8.0, found) == 0);
+
+    // Queries only read the world, so they can run from several threads at once
+    std::vector<std::thread> threads;
+    std::vector<int> matches(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&world, &matches, t]() {
+            RaycastHit local;
+            for (int i = 0; i < 1000; ++i)
+                matches[t] += world.Raycast(Vector2d(0, i % 10 - 5), Vector2d(1, 0), 1000.0, local) && local.object->GetPosition().x == 50;
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (int m : matches) assert(m == matches[0] && m > 0);
+}
+
+// UUID lookups and handles must follow objects through swap-and-pop removal
+static void TestObjectIndex() {
+    World world(true);
+    std::vector<GameObject*> spawned;
+    for (int i = 0; i < 10; ++i) spawned.push_back(&world.SpawnObject<GameObject>());
+
+    for (GameObject* obj : spawned) {
+        assert(world.Find(obj->GetUUID()) == obj);
+        assert(world.Resolve(obj->GetHandle()) == obj && world.Contains(obj));
+    }
+
+    // The last object moves into the removed one's place and keeps its handle
+    ObjectHandle removed = spawned[3]->GetHandle();
+    UUID removedId = spawned[3]->GetUUID();
+    world.RemoveObject(spawned[3]);
+    assert(world.GetObjects().size() == 9 && world.GetObjects()[3].get() == spawned[9]);
+    assert(world.Find(removedId) == nullptr && world.Resolve(removed) == nullptr);
+    assert(world.Resolve(spawned[9]->GetHandle()) == spawned[9]);
+
+    // The freed slot is reused under a new generation
+    auto& reused = world.SpawnObject<GameObject>();
+    assert(reused.GetHandle().index == removed.index && !(reused.GetHandle() == removed));
+    assert(world.Resolve(removed) == nullptr);
+
+    // Destroyed objects are queued once and removed by ProcessDestroyQueue
+    UUID destroyedId = spawned[5]->GetUUID();
+    spawned[5]->Destroy();
+    spawned[5]->Destroy();
+    world.ProcessDestroyQueue();
+    assert(world.GetObjects().size() == 9 && world.Find(destroyedId) == nullptr);
+
+    // Overwriting an object's UUID keeps it findable
+    PacketCodec codec;
+    GameObject source;
+    source.Encode(codec);
+    UUID before = spawned[0]->GetUUID();
+    spawned[0]->Decode(codec);
+    assert(world.Find(source.GetUUID()) == spawned[0] && world.Find(before) == nullptr);
+}
+
+// Object events raised during a tick are coalesced and fired once physics is done
+static void TestDeferredEvents() {
+    World world(true);
+    PhysicsSettings settings;
+    settings.sleepTicks = 0;
+    world.SetPhysicsSettings(settings);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(-20, -500));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 20.0, 1000.0 }), CollisionGroup::DefaultCollidable, true);
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(40, 0));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    int moved = 0, collided = 0, entered = 0, exited = 0;
+    Vector2d lastMove;
+    box.Moved.ConnectPersistent([&](Vector2d pos) {
+        assert(!world.IsRecordingEvents());
+        ++moved;
+        lastMove = pos;
+    });
+    box.Collided.ConnectPersistent([&](GameObject* other) { assert(other == &wall); ++collided; });
+    box.TriggerEntered.ConnectPersistent([&](GameObject* other) { assert(other == &wall); ++entered; });
+    box.TriggerExited.ConnectPersistent([&](GameObject* other) { assert(other == &wall); ++exited; });
+
+    // Falling onto the trigger wall: at most one Moved and one Collided per tick, one enter overall
+    for (int i = 0; i < 16; ++i) {
+        moved = collided = 0;
+        box.SetAcceleration(Vector2d(-2000, 0));
+        world.Tick(1.0f / 64.0f);
+        assert(moved <= 1 && collided <= 1);
+        if (moved) assert(lastMove == box.GetPosition());
+    }
+    assert(moved == 0 && collided == 1 && entered == 1 && exited == 0);
+    assert(world.GetEvents().GetTriggerContactCount() == 1);
+
+    box.SetVelocity(Vector2d(0, 0));
+    box.SetPosition(Vector2d(500, 0));
+    world.Tick(1.0f / 64.0f);
+    assert(entered == 1 && exited == 1);
+
+    // Destroying during the tick only fires Destroyed after it
+    bool destroyedFired = false;
+    box.Destroyed.ConnectPersistent([&] { destroyedFired = true; });
+    box.Ticked.ConnectOncePersistent([&](float) { box.Destroy(); assert(!destroyedFired); });
+    world.Tick(1.0f / 64.0f);
+    assert(destroyedFired);
+
+    // Removing an object mid-tick drops its events, even when its slot is reused in the same tick
+    auto& mover = world.SpawnObject<GameObject>();
+    int moverMoves = 0, reusedMoves = 0;
+    uint32_t moverSlot = mover.GetHandle().index;
+    std::unique_ptr<GameObject> released;
+    GameObject* reused = nullptr;
+    mover.Moved.ConnectPersistent([&](Vector2d) { ++moverMoves; });
+    mover.Ticked.ConnectOncePersistent([&](float) {
+        mover.SetPosition(Vector2d(0, 100));
+        released = world.ReleaseObject(&mover);
+        reused = &world.SpawnObject<GameObject>();
+        reused->Moved.ConnectPersistent([&](Vector2d) { ++reusedMoves; });
+        reused->SetPosition(Vector2d(0, 200));
+    });
+    world.Tick(1.0f / 64.0f);
+    assert(released && reused->GetHandle().index == moverSlot);
+    assert(moverMoves == 0 && reusedMoves == 1);
+}
+
+// Objects tick at their tier's rate with the time accumulated since their last tick
+static void TestTickTiers() {
+    World world(true);
+    const float dt = 1.0f / 16.0f;
+
+    std::vector<GameObject*> spawned;
+    std::vector<int> ticks(4, 0);
+    std::vector<double> elapsed(4, 0.0);
+    for (int i = 0; i < 4; ++i) {
+        auto& obj = world.SpawnObject<GameObject>();
+        obj.Ticked.ConnectPersistent([&, i](float objectDt) { ++ticks[i]; elapsed[i] += objectDt; });
+        spawned.push_back(&obj);
+    }
+    world.SetTickTier(spawned[1], TickTier::Every2nd);
+    world.SetTickTier(spawned[2], TickTier::Every8th);
+    world.SetTickTier(spawned[3], TickTier::Dormant);
+    assert(world.GetTickTier(spawned[2]) == TickTier::Every8th);
+
+    for (int i = 0; i < 16; ++i) {
+        world.Tick(dt);
+        assert(world.GetTickScheduler().GetTickedCount() <= 3);
+    }
+    assert(ticks[0] == 16 && ticks[1] == 8 && ticks[2] == 2 && ticks[3] == 0);
+    assert(std::abs(elapsed[0] - 1.0) < 1e-6);
+    assert(elapsed[1] > 1.0 - 2 * dt && elapsed[1] < 1.0 + 1e-6);
+    assert(elapsed[2] > 1.0 - 8 * dt && elapsed[2] < 1.0 + 1e-6);
+
+    // Woken up, a dormant object catches up on everything it slept through
+    world.SetTickTier(spawned[3], TickTier::EveryTick);
+    world.Tick(dt);
+    assert(ticks[3] == 1 && std::abs(elapsed[3] - 17 * dt) < 1e-6);
+
+    // Automatic tiers follow the distance to the nearest player entity; pinned ones stay
+    world.SpawnPlayer(std::make_unique<LogicalPlayer>(1, "p"), Vector2d(0, 0));
+    const double distances[] = { 100.0, 1000.0, 2000.0, 5000.0 };
+    for (int i = 0; i < 4; ++i) spawned[i]->SetPosition(Vector2d(distances[i], 0));
+    world.SetTickTier(spawned[0], TickTier::EveryTick, false);
+    world.SetTickTier(spawned[1], TickTier::EveryTick, false);
+    world.SetTickTier(spawned[2], TickTier::EveryTick, false);
+
+    TickLodSettings lod;
+    lod.enabled = true;
+    lod.reassignTicks = 1;
+    world.SetTickLodSettings(lod);
+    world.Tick(dt);
+    assert(world.GetTickTier(spawned[0]) == TickTier::EveryTick);
+    assert(world.GetTickTier(spawned[1]) == TickTier::Every2nd);
+    assert(world.GetTickTier(spawned[2]) == TickTier::Every8th);
+    assert(world.GetTickTier(spawned[3]) == TickTier::EveryTick); // pinned above
+    assert(world.GetTickScheduler().GetCount(TickTier::EveryTick) == 3); // with the player's entity
+
+    // Removed objects leave their bucket
+    world.RemoveObject(spawned[2]);
+    assert(world.GetTickScheduler().GetCount(TickTier::Every8th) == 0);
+}
+
+// Tagged objects are found through the world's tag index as tags and objects come and go
+static void TestTagIndex() {
+    World world(true);
+    TagId crate = Tags::Intern("Crate");
+
+    std::vector<GameObject*> crates;
+    for (int i = 0; i < 5; ++i) {
+        auto& obj = world.SpawnObject<GameObject>();
+        if (i % 2 == 0) {
+            obj.AddTag(crate);
+            crates.push_back(&obj);
+        }
+    }
+    auto tagged = std::make_unique<GameObject>();
+    tagged->AddTag("Crate");
+    GameObject* added = tagged.get();
+    world.AddObject(std::move(tagged));
+    crates.push_back(added);
+
+    auto matches = [&](std::vector<GameObject*> expected) {
+        std::vector<GameObject*> found = world.GetObjectsWithTag("Crate");
+        std::sort(found.begin(), found.end());
+        std::sort(expected.begin(), expected.end());
+        return found == expected;
+    };
+    assert(matches(crates));
+    assert(world.GetObjectsWithTag("NeverInterned").empty());
+
+    world.RemoveObject(crates[0]);
+    crates[1]->RemoveTag(crate);
+    assert(matches({ crates[2], crates[3] }));
+
+    std::unique_ptr<GameObject> released = world.ReleaseObject(crates[3]);
+    released->RemoveTag(crate); // outside the world: nothing to update
+    assert(matches({ crates[2] }));
+}
+
+// A body pressed against a wall and sliding along it drops off the wall's end;
+// its cached contact must not keep holding it up once the wall is gone
+static void TestSlideOffWallEnd(bool warmStarting) {
+    World world(true);
+    PhysicsSettings settings;
+    settings.warmStarting = warmStarting;
+    settings.sleepTicks = 0;
+    world.SetPhysicsSettings(settings);
+
+    auto& wall = world.SpawnObject<GameObject>();
+    wall.SetPosition(Vector2d(-20, -50));
+    wall.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 20.0, 100.0 }));
+    wall.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(5, 0));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    for (int i = 0; i < 128; ++i) {
+        Vector2d v = box.GetVelocity();
+        box.SetVelocity(Vector2d(v.x, 64));
+        box.SetAcceleration(Vector2d(-200, 0));
+        world.Tick(1.0f / 64.0f);
+        // Beside the wall the box never goes through it
+        if (box.GetPosition().y + 10.0 < 50.0) assert(box.GetPosition().x >= -1e-3);
+    }
+    assert(box.GetPosition().y > 100.0);
+    assert(box.GetPosition().x < -20.0);
+}
+
+// Trigger enter / exit follow overlap, not contact impulses: a body resting
+// inside or against a trigger stays in it
+static void TestTriggerOverlap() {
+    World world(true);
+    PhysicsSettings settings;
+    settings.sleepTicks = 0;
+    world.SetPhysicsSettings(settings);
+
+    auto& zone = world.SpawnObject<GameObject>();
+    zone.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 100.0, 100.0 }), CollisionGroup::DefaultCollidable, true);
+    zone.GetPhysicalProperties()->SetAnchored(true);
+
+    auto& inside = world.SpawnObject<GameObject>();
+    inside.SetPosition(Vector2d(45, 45));
+    inside.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    auto& beside = world.SpawnObject<GameObject>();
+    beside.SetPosition(Vector2d(100.001, 0));
+    beside.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+
+    int entered = 0, exited = 0;
+    zone.TriggerEntered.ConnectPersistent([&](GameObject*) { ++entered; });
+    zone.TriggerExited.ConnectPersistent([&](GameObject*) { ++exited; });
+
+    for (int i = 0; i < 16; ++i) {
+        world.Tick(1.0f / 64.0f);
+        assert(entered == 2 && exited == 0);
+        assert(world.GetEvents().GetTriggerContactCount() == 2);
+    }
+
+    inside.SetPosition(Vector2d(500, 500));
+    world.Tick(1.0f / 64.0f);
+    assert(entered == 2 && exited == 1);
+}
+
+// Health lives in the world's packed store and regenerates there, following
+// objects in and out of the world
+static void TestHealthSystem() {
+    World world(true);
+    const float dt = 1.0f / 64.0f;
+
+    std::vector<PlayerEntity*> players;
+    for (int i = 0; i < 8; ++i) {
+        auto& player = world.SpawnObject<PlayerEntity>();
+        player.SetHealth(10 * i);
+        player.SetHealAmount(64 * (i % 3)); // per second: i % 3 per tick
+        players.push_back(&player);
+    }
+    assert(world.GetHealthStore().Size() == 8);
+    players[2]->GetHealthComponent()->SetEnabled(false);
+
+    for (int t = 0; t < 30; ++t) world.Tick(dt);
+    assert(players[0]->GetHealth() == 0 && players[1]->GetHealth() == 40);
+    assert(players[2]->GetHealth() == 20 && players[5]->GetHealth() == 100);
+
+    // Leaving the world copies the state back, and nothing regenerates it there
+    auto released = world.ReleaseObject(players[1]);
+    assert(world.GetHealthStore().Size() == 7 && players[1]->GetHealth() == 40);
+    released->Tick(dt);
+    assert(players[1]->GetHealth() == 40);
+
+    // Removed objects drop out of the store, and the last entry fills the gap
+    players[4]->TakeDamage(5);
+    world.RemoveObject(players[3]);
+    assert(world.GetHealthStore().Size() == 6 && players[4]->GetHealth() == 65);
+
+    // Health added to an object already in the world joins the store
+    auto& late = world.SpawnObject<GameObject>();
+    auto& health = late.AddComponent<HealthComponent>(50);
+    health.SetHealth(10);
+    health.SetHealAmount(64);
+    assert(world.GetHealthStore().Size() == 7 && health.IsStored());
+    world.Tick(dt);
+    assert(health.GetHealth() == 11 && players[4]->GetHealth() == 66);
+}
+
+// Regeneration is a world system, so it heals as fast on every tier
+static void TestRegenAcrossTiers() {
+    World world(true);
+    const float dt = 1.0f / 64.0f;
+    const TickTier tiers[] = { TickTier::EveryTick, TickTier::Every2nd, TickTier::Every8th };
+
+    std::vector<PlayerEntity*> players;
+    for (TickTier tier : tiers) {
+        auto& player = world.SpawnObject<PlayerEntity>();
+        player.SetHealth(10);
+        player.SetHealAmount(30); // per second
+        world.SetTickTier(&player, tier);
+        players.push_back(&player);
+    }
+
+    for (int i = 0; i < 128; ++i) world.Tick(dt);
+
+    // Two seconds of regen
+    for (auto* player : players)
+        assert(player->GetHealth() == 70);
+}
+
+// Rays may be unbounded; every broadphase must still end its walk
+static void TestInfiniteRay(BroadphaseType type) {
+    World world(true);
+    PhysicsSettings settings;
+    settings.broadphase = type;
+    world.SetPhysicsSettings(settings);
+
+    auto& box = world.SpawnObject<GameObject>();
+    box.SetPosition(Vector2d(1000, -5));
+    box.GetHitbox()->AddHitbox(RectShape(Rect2d { 0.0, 0.0, 10.0, 10.0 }));
+    world.Tick(1.0f / 60.0f);
+
+    RaycastHit hit;
+    assert(world.Raycast(Vector2d(0, 0), Vector2d(1, 0), INFINITY, hit) && hit.object == &box);
+    assert(std::abs(hit.distance - 1000.0) < 1e-6);
+    assert(!world.Raycast(Vector2d(0, 0), Vector2d(-1, 0), INFINITY, hit));
+    assert(!world.Raycast(Vector2d(1e12, 1e12), Vector2d(1, 1), INFINITY, hit));
+    assert(world.Raycast(Vector2d(-1e12, 0), Vector2d(1, 0), INFINITY, hit) && hit.object == &box);
+}
+
 int main() {
     World initial(true);
     World after(true);
     PacketCodec codec;
 
-    
+    for (auto solver : { SolverMode::Global, SolverMode::Islands }) {
+        TestWallStopsBody(BroadphaseType::SpatialHash, solver);
+        TestWallStopsBody(BroadphaseType::AABBTree, solver);
+    }
+    TestStaticLayerTracksWalls();
+    TestBroadphaseQueries();
+    TestTreePairsStayCurrent();
+    TestBodyStoreBinding();
+    TestSleepingBodies();
+    TestWarmStartedContacts(true);
+    TestWarmStartedContacts(false);
+    TestSlideOffWallEnd(true);
+    TestSlideOffWallEnd(false);
+    TestCachedBounds();
+    TestShardedWorld();
+    TestShardedGhostCollisions();
+    TestShardedGhostRefresh();
+    TestShardedReplication();
+    TestCollisionFiltering();
+    TestSceneQueries();
+    TestQueriesDuringTick();
+    TestInfiniteRay(BroadphaseType::SpatialHash);
+    TestInfiniteRay(BroadphaseType::AABBTree);
+    TestObjectIndex();
+    TestDeferredEvents();
+    TestTriggerOverlap();
+    TestTickTiers();
+    TestHealthSystem();
+    TestRegenAcrossTiers();
+    TestTagIndex();
+    TestParallelNarrowphaseMatchesSerial(SolverMode::Global);
+    TestParallelNarrowphaseMatchesSerial(SolverMode::Islands);
 
     return 0;
-}
\ No newline at end of file
+}